@@ -110,6 +110,68 @@ if(${PROJECT_BINARY_DIR} STREQUAL ${CMAKE_CURRENT_BINARY_DIR})
         uninstall
         COMMAND rm -f ${FULL_NAME_INSTALLED_EXEC_LIST}
         COMMENT "Uninstalling the application ${FULL_NAME_INSTALLED_EXEC_LIST}")
+
+      # benchmark runs compared against a baseline stored in the source tree,
+      # see tools/bench-compare.py
+      set(BENCH_REPETITIONS
+          10
+          CACHE STRING "Repetitions of every benchmark, the compared samples")
+      set(BENCH_CONFIDENCE
+          0.99
+          CACHE STRING "Confidence level of the regression intervals")
+      set(BENCH_THRESHOLD
+          0.05
+          CACHE STRING "Smallest relative slowdown reported as a regression")
+      set(BENCH_FILTER
+          ""
+          CACHE STRING "--benchmark_filter of the benchmark runs")
+      set(BENCH_COMPARE_SCRIPT ${CMAKE_CURRENT_LIST_DIR}/tools/bench-compare.py)
+      find_package(Python3 COMPONENTS Interpreter)
+
+      add_custom_target(bench-run)
+      add_custom_target(bench-baseline)
+      add_custom_target(bench-compare)
+
+      # <target>-run writes bench/<target>.json, <target>-baseline stores it
+      # as the baseline and <target>-compare checks it against the baseline
+      function(add_benchmark_baseline target baseline)
+        set(out ${CMAKE_BINARY_DIR}/bench/${target}.json)
+        set(run
+            $<TARGET_FILE:${target}>
+            --benchmark_repetitions=${BENCH_REPETITIONS}
+            --benchmark_enable_random_interleaving=true
+            --benchmark_out=${out} --benchmark_out_format=json)
+        if(BENCH_FILTER)
+          list(APPEND run --benchmark_filter=${BENCH_FILTER})
+        endif()
+
+        add_custom_target(
+          ${target}-run
+          COMMAND ${CMAKE_COMMAND} -E make_directory ${CMAKE_BINARY_DIR}/bench
+          COMMAND ${run}
+          DEPENDS ${target}
+          COMMENT "Running ${target}"
+          USES_TERMINAL VERBATIM)
+        add_custom_target(
+          ${target}-baseline
+          COMMAND ${CMAKE_COMMAND} -E copy ${out} ${baseline}
+          DEPENDS ${target}-run
+          COMMENT "Storing the ${target} baseline in ${baseline}"
+          VERBATIM)
+        add_custom_target(
+          ${target}-compare
+          COMMAND
+            ${Python3_EXECUTABLE} ${BENCH_COMPARE_SCRIPT} ${baseline} ${out}
+            --confidence ${BENCH_CONFIDENCE} --threshold ${BENCH_THRESHOLD}
+            --json ${CMAKE_BINARY_DIR}/bench/${target}-compare.json
+          DEPENDS ${target}-run
+          COMMENT "Comparing ${target} against ${baseline}"
+          USES_TERMINAL VERBATIM)
+
+        add_dependencies(bench-run ${target}-run)
+        add_dependencies(bench-baseline ${target}-baseline)
+        add_dependencies(bench-compare ${target}-compare)
+      endfunction()
     else() # Debug
       set(CMAKE_INSTALL_PREFIX /tmp/)
       message("Debug mode ${PROJECT_BINARY_DIR}")
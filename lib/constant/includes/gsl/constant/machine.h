@@ -3,6 +3,9 @@
  */
 #pragma once
 
+#include <concepts>
+#include <limits>
+
 namespace gsl::constant::machine {
 
 /* magic constants; mostly for the benefit of the implementation */
@@ -97,4 +100,99 @@ constexpr auto ROOT5_MACH_EPS = 0.00100;
 constexpr auto ROOT6_MACH_EPS = 0.00316;
 constexpr auto LOG_MACH_EPS = -34.54;
 
-}  // namespace gsl::constant::machine
\ No newline at end of file
+/* The thresholds above as a traits template
+ *
+ * machine<T>::SQRT_MAX and friends are constexpr values of T for float,
+ * double and long double, so generic code picks the threshold of its own
+ * type instead of the double one. They are derived from
+ * std::numeric_limits<T> at compile time and follow whatever format long
+ * double has: the powers of two are exact, the roots and logarithms within
+ * an ulp of the correctly rounded value. That is closer than the tables
+ * above, whose odd roots of MIN and MAX are off by tens of ulps. */
+
+namespace detail {
+
+/* 2^e, exact over the exponents of normal numbers */
+template <std::floating_point T>
+constexpr T exp2(int e) {
+  T r = 1;
+  T b = e < 0 ? T{0.5} : T{2};
+  for (unsigned k = e < 0 ? -e : e; k != 0; k >>= 1) {
+    if (k & 1) r *= b;
+    if (k > 1) b *= b;
+  }
+  return r;
+}
+
+/* (m 2^e)^(1/n) for m in [1, 2): with e = q n + r and 0 <= r < n it is
+ * 2^q (m 2^r)^(1/n), the root of m 2^r < 2^n by Newton's method from 2,
+ * which decreases to the root until rounding stops it */
+template <std::floating_point T>
+constexpr T root(T m, int e, int n) {
+  int q = e / n, r = e % n;
+  if (r < 0) {
+    r += n;
+    q -= 1;
+  }
+  const T x = m * exp2<T>(r);
+  T y = 2;
+  for (;;) {
+    T p = 1;
+    for (int i = 1; i < n; i++) p *= y;
+    const T next = y - (p * y - x) / (static_cast<T>(n) * p);
+    if (!(next < y)) break;
+    y = next;
+  }
+  return y * exp2<T>(q);
+}
+
+template <std::floating_point T>
+constexpr T ln2 = 0.693147180559945309417232121458176568L;
+template <>
+constexpr double ln2<double> = 0.693147180559945309417232121458176568;
+template <>
+constexpr float ln2<float> = 0.693147180559945309417232121458176568F;
+
+}  // namespace detail
+
+template <std::floating_point T>
+struct machine {
+ private:
+  using limits = std::numeric_limits<T>;
+  static_assert(limits::radix == 2);
+
+  /* EPSILON = 2^(1 - p), MIN = 2^(emin - 1), MAX = (2 - 2^(1 - p))
+   * 2^(emax - 1) in the terms of numeric_limits */
+  static constexpr int eps_exp = 1 - limits::digits;
+  static constexpr int min_exp = limits::min_exponent - 1;
+  static constexpr int max_exp = limits::max_exponent - 1;
+  static constexpr T max_m = 2 - limits::epsilon();
+
+ public:
+  static constexpr T EPSILON = limits::epsilon();
+  static constexpr T SQRT_EPSILON = detail::root<T>(1, eps_exp, 2);
+  static constexpr T ROOT3_EPSILON = detail::root<T>(1, eps_exp, 3);
+  static constexpr T ROOT4_EPSILON = detail::root<T>(1, eps_exp, 4);
+  static constexpr T ROOT5_EPSILON = detail::root<T>(1, eps_exp, 5);
+  static constexpr T ROOT6_EPSILON = detail::root<T>(1, eps_exp, 6);
+  static constexpr T LOG_EPSILON = eps_exp * detail::ln2<T>;
+
+  static constexpr T MIN = limits::min();
+  static constexpr T SQRT_MIN = detail::root<T>(1, min_exp, 2);
+  static constexpr T ROOT3_MIN = detail::root<T>(1, min_exp, 3);
+  static constexpr T ROOT4_MIN = detail::root<T>(1, min_exp, 4);
+  static constexpr T ROOT5_MIN = detail::root<T>(1, min_exp, 5);
+  static constexpr T ROOT6_MIN = detail::root<T>(1, min_exp, 6);
+  static constexpr T LOG_MIN = min_exp * detail::ln2<T>;
+
+  static constexpr T MAX = limits::max();
+  static constexpr T SQRT_MAX = detail::root<T>(max_m, max_exp, 2);
+  static constexpr T ROOT3_MAX = detail::root<T>(max_m, max_exp, 3);
+  static constexpr T ROOT4_MAX = detail::root<T>(max_m, max_exp, 4);
+  static constexpr T ROOT5_MAX = detail::root<T>(max_m, max_exp, 5);
+  static constexpr T ROOT6_MAX = detail::root<T>(max_m, max_exp, 6);
+  /* log(2 - 2^(1 - p)) = ln 2 - 2^-p, the correction is below an ulp */
+  static constexpr T LOG_MAX = (max_exp + 1) * detail::ln2<T>;
+};
+
+}  // namespace gsl::constant::machine
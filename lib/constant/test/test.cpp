@@ -20,6 +20,7 @@
 
 #include <gsl/constant/cgs.h>
 #include <gsl/constant/cgsm.h>
+#include <gsl/constant/machine.h>
 #include <gsl/constant/mks.h>
 #include <gsl/constant/mksa.h>
 #include <gsl/constant/num.h>
@@ -27,6 +28,8 @@
 
 #include <cmath>
 #include <cstdlib>
+#include <limits>
+#include <type_traits>
 
 #define MESSAGE(v) std::cout << "MESSAGE: " << #v << " => " << (v) << "\n";
 #define EXPECT_EQ_REL_DBLE(a, b, e) \
@@ -93,3 +96,54 @@ TEST(GSLContant, ConstantsStefanBoltzmannConstantTest) {
 
   EXPECT_EQ_REL_DBL(s, sigma);
 }
+
+/* The DBL_ and FLT_ names of machine.h are taken by the <cfloat> macros in
+ * here, the traits are checked against the library functions instead */
+template <typename T>
+void check_machine_traits(T e) {
+  using m = gsl::constant::machine::machine<T>;
+  using lim = std::numeric_limits<T>;
+  static_assert(std::is_same_v<decltype(m::SQRT_MAX), const T>);
+  static_assert(m::EPSILON == lim::epsilon() && m::MIN == lim::min());
+  static_assert(m::MAX == lim::max());
+
+  EXPECT_EQ_REL_DBLE(m::SQRT_EPSILON, std::sqrt(m::EPSILON), e);
+  EXPECT_EQ_REL_DBLE(m::ROOT3_EPSILON, std::cbrt(m::EPSILON), e);
+  EXPECT_EQ_REL_DBLE(m::LOG_EPSILON, std::log(m::EPSILON), e);
+  EXPECT_EQ_REL_DBLE(m::SQRT_MIN, std::sqrt(m::MIN), e);
+  EXPECT_EQ_REL_DBLE(m::ROOT3_MIN, std::cbrt(m::MIN), e);
+  EXPECT_EQ_REL_DBLE(m::LOG_MIN, std::log(m::MIN), e);
+  EXPECT_EQ_REL_DBLE(m::SQRT_MAX, std::sqrt(m::MAX), e);
+  EXPECT_EQ_REL_DBLE(m::ROOT3_MAX, std::cbrt(m::MAX), e);
+  EXPECT_EQ_REL_DBLE(m::LOG_MAX, std::log(m::MAX), e);
+
+  /* the other roots through their powers, a few roundings each */
+  const T p = 8 * e;
+  EXPECT_EQ_REL_DBLE(m::ROOT4_EPSILON * m::ROOT4_EPSILON, m::SQRT_EPSILON, p);
+  EXPECT_EQ_REL_DBLE(m::ROOT6_EPSILON * m::ROOT6_EPSILON, m::ROOT3_EPSILON,
+                     p);
+  EXPECT_EQ_REL_DBLE(std::pow(m::ROOT5_EPSILON, T{5}), m::EPSILON, p);
+  EXPECT_EQ_REL_DBLE(m::ROOT4_MIN * m::ROOT4_MIN, m::SQRT_MIN, p);
+  EXPECT_EQ_REL_DBLE(m::ROOT6_MIN * m::ROOT6_MIN, m::ROOT3_MIN, p);
+  EXPECT_EQ_REL_DBLE(std::pow(m::ROOT5_MIN, T{5}), m::MIN, p);
+  EXPECT_EQ_REL_DBLE(m::ROOT4_MAX * m::ROOT4_MAX, m::SQRT_MAX, p);
+  EXPECT_EQ_REL_DBLE(m::ROOT6_MAX * m::ROOT6_MAX, m::ROOT3_MAX, p);
+  EXPECT_EQ_REL_DBLE(std::pow(m::ROOT5_MAX, T{5}) / m::MAX, T{1}, p);
+}
+
+TEST(GSLContant, MachineTraitsTest) {
+  /* the double ones agree with the correctly rounded entries of the
+   * tables */
+  using d = gsl::constant::machine::machine<double>;
+  static_assert(d::SQRT_EPSILON == 1.4901161193847656e-08);
+  static_assert(d::LOG_EPSILON == -3.6043653389117154e+01);
+  static_assert(d::SQRT_MIN == 1.4916681462400413e-154);
+  static_assert(d::LOG_MIN == -7.0839641853226408e+02);
+  static_assert(d::ROOT4_MAX == 1.1579208923731620e+77);
+  static_assert(d::LOG_MAX == 7.0978271289338397e+02);
+
+  check_machine_traits<float>(2 * std::numeric_limits<float>::epsilon());
+  check_machine_traits<double>(2 * std::numeric_limits<double>::epsilon());
+  check_machine_traits<long double>(
+      2 * std::numeric_limits<long double>::epsilon());
+}
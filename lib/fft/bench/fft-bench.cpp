@@ -0,0 +1,194 @@
+#include <benchmark/benchmark.h>
+#include <gsl/fft/chirp.h>
+#include <gsl/fft/grid.h>
+#include <gsl/fft/plan.h>
+#include <gsl/fft/real.h>
+#include <gsl/fft/roots.h>
+#include <gsl/type/complex.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+/* Throughput of the complex transforms of gsl/fft/plan.h
+ *
+ * Registered as
+ *
+ *   <transform>/<type>/<n>
+ *
+ * forward    out of place forward transform of a plan made before the loop
+ * in_place   the same in place
+ * real       forward transform of n reals to n / 2 + 1 points
+ *
+ * for powers of two and mixed radix lengths,
+ *
+ *   chirp/<type>/<n>
+ *
+ * the forward transform of a chirp_plan for prime and other lengths, and
+ *
+ *   grid/<type>/<n>/<rank>/<threads>
+ *
+ * in place forward transforms of n^rank grids with a grid_plan on 1, 2, 4
+ * and 8 threads and on all of them (threads 0), with the seconds of every
+ * stage of the last run as the counters axis<a>_wall, axis<a>_transform and
+ * axis<a>_copy, the last two summed over the threads. The items per second
+ * are points, the bytes per second the input read.
+ *
+ *   roots/<type>/<n>, plan/<type>/<n>
+ *
+ * are the lookup of the cached table of roots of unity of n and the
+ * construction of a plan of n, which copies its twiddles from it. */
+
+namespace {
+
+using gsl::type::complex_base;
+
+template <typename T>
+std::vector<complex_base<T>> inputs(std::size_t n) {
+  std::mt19937 gen(1);
+  std::uniform_real_distribution<T> u(-1, 1);
+  std::vector<complex_base<T>> r(n);
+  for (auto& z : r) z = {u(gen), u(gen)};
+  return r;
+}
+
+template <typename T>
+void set_counters(benchmark::State& state, std::size_t n) {
+  const auto runs = static_cast<std::int64_t>(state.iterations());
+  state.SetItemsProcessed(runs * static_cast<std::int64_t>(n));
+  const auto bytes = n * sizeof(complex_base<T>);
+  state.SetBytesProcessed(runs * static_cast<std::int64_t>(bytes));
+}
+
+template <typename T>
+void forward(benchmark::State& state) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  gsl::fft::plan<T> p(n);
+  const auto x = inputs<T>(n);
+  std::vector<complex_base<T>> y(n);
+  for (auto _ : state) {
+    p.forward(x, y);
+    benchmark::DoNotOptimize(y.data());
+    benchmark::ClobberMemory();
+  }
+  set_counters<T>(state, n);
+}
+
+template <typename T>
+void in_place(benchmark::State& state) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  gsl::fft::plan<T> p(n);
+  auto x = inputs<T>(n);
+  for (auto _ : state) {
+    p.forward(x);
+    benchmark::DoNotOptimize(x.data());
+    benchmark::ClobberMemory();
+  }
+  set_counters<T>(state, n);
+}
+
+template <typename T>
+void real(benchmark::State& state) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  gsl::fft::real_plan<T> p(n);
+  std::vector<T> x(n);
+  for (std::size_t i = 0; auto z : inputs<T>(n)) x[i++] = z.real();
+  std::vector<complex_base<T>> y(p.spectrum_size());
+  for (auto _ : state) {
+    p.forward(x, y);
+    benchmark::DoNotOptimize(y.data());
+    benchmark::ClobberMemory();
+  }
+  const auto runs = static_cast<std::int64_t>(state.iterations());
+  state.SetItemsProcessed(runs * static_cast<std::int64_t>(n));
+  state.SetBytesProcessed(runs * static_cast<std::int64_t>(n * sizeof(T)));
+}
+
+template <typename T>
+void chirp(benchmark::State& state) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  gsl::fft::chirp_plan<T> p(n);
+  const auto x = inputs<T>(n);
+  std::vector<complex_base<T>> y(n);
+  for (auto _ : state) {
+    p.forward(x, y);
+    benchmark::DoNotOptimize(y.data());
+    benchmark::ClobberMemory();
+  }
+  set_counters<T>(state, n);
+}
+
+template <typename T>
+void grid(benchmark::State& state) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  const std::vector<std::size_t> shape(state.range(1), n);
+  gsl::fft::grid_plan<T> p(shape, static_cast<std::size_t>(state.range(2)));
+  auto x = inputs<T>(p.size());
+  for (auto _ : state) {
+    p.forward(x);
+    benchmark::DoNotOptimize(x.data());
+    benchmark::ClobberMemory();
+  }
+  set_counters<T>(state, p.size());
+  using seconds = std::chrono::duration<double>;
+  for (const auto& t : p.timings()) {
+    const auto axis = "axis" + std::to_string(t.axis);
+    state.counters[axis + "_wall"] = seconds(t.wall).count();
+    state.counters[axis + "_transform"] = seconds(t.transform).count();
+    state.counters[axis + "_copy"] = seconds(t.copy).count();
+  }
+}
+
+template <typename T>
+void roots(benchmark::State& state) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  for (auto _ : state) {
+    const gsl::fft::roots<T> w(n);
+    benchmark::DoNotOptimize(w.values().data());
+  }
+}
+
+template <typename T>
+void construct(benchmark::State& state) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  for (auto _ : state) {
+    const gsl::fft::plan<T> p(n);
+    benchmark::DoNotOptimize(&p);
+  }
+}
+
+void sizes(benchmark::internal::Benchmark* b) {
+  for (const auto n : {64, 1024, 16384, 65536}) b->Arg(n);
+  for (const auto n : {60, 1000, 2 * 3 * 5 * 7 * 16, 3 * 5 * 7 * 7 * 9}) {
+    b->Arg(n);
+  }
+}
+
+}  // namespace
+
+BENCHMARK(forward<float>)->Name("forward/float")->Apply(sizes);
+BENCHMARK(forward<double>)->Name("forward/double")->Apply(sizes);
+BENCHMARK(in_place<float>)->Name("in_place/float")->Apply(sizes);
+BENCHMARK(in_place<double>)->Name("in_place/double")->Apply(sizes);
+BENCHMARK(real<float>)->Name("real/float")->Apply(sizes);
+BENCHMARK(real<double>)->Name("real/double")->Apply(sizes);
+BENCHMARK(chirp<float>)->Name("chirp/float")->Arg(1021)->Arg(3000)->Arg(4093);
+BENCHMARK(chirp<double>)->Name("chirp/double")->Arg(1021)->Arg(3000)->Arg(4093);
+BENCHMARK(grid<float>)
+    ->Name("grid/float")
+    ->ArgsProduct({{2048}, {2}, {1, 2, 4, 8, 0}})
+    ->ArgsProduct({{128}, {3}, {1, 2, 4, 8, 0}})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(grid<double>)
+    ->Name("grid/double")
+    ->ArgsProduct({{2048}, {2}, {1, 2, 4, 8, 0}})
+    ->ArgsProduct({{128}, {3}, {1, 2, 4, 8, 0}})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(roots<float>)->Name("roots/float")->Arg(1024)->Arg(65536);
+BENCHMARK(roots<double>)->Name("roots/double")->Arg(1024)->Arg(65536);
+BENCHMARK(construct<double>)->Name("plan/double")->Arg(1024)->Arg(65536);
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <gsl/fft/plan.h>
+#include <gsl/type/complex.h>
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace gsl::fft {
+
+/* Chirp-z transforms (Bluestein's algorithm)
+ *
+ * A chirp_plan<T> evaluates the transform of n points at m frequencies
+ * spaced 1 / bins cycles per sample apart from first / bins on:
+ *
+ *   forward    y[j] = sum_t x[t] exp(-2 pi i t (first + j) / bins)
+ *   backward   y[j] = sum_t x[t] exp(+2 pi i t (first + j) / bins)
+ *   inverse    backward / bins
+ *
+ * j = 0 .. m - 1. chirp_plan(n) is the DFT of plan<T> for any n, bins = m
+ * = n and first = 0, primes included. The general form is a zoom FFT: the
+ * band [first, first + m) / bins of a spectrum sampled bins / n times finer
+ * than the DFT, the transform of the points zero padded to bins, without
+ * computing the rest of it.
+ *
+ * With t j = (t^2 + j^2 - (j - t)^2) / 2 the transform is the convolution
+ * of x[t] exp(-i pi (t^2 + 2 first t) / bins) with the chirp
+ * exp(i pi t^2 / bins), followed by the chirp exp(-i pi j^2 / bins). The
+ * convolution runs through a plan<T> of the next length from n + m - 1 up
+ * that it accepts. Both chirps and the transform of the convolution chirp
+ * are computed with the plan; the phases are reduced modulo 2 bins in
+ * integers, every factor is one correctly rounded root of unity of 2 bins.
+ * They come from the gsl/fft/roots.h table of 2 bins when it is no larger
+ * than about the convolution, and are computed one at a time otherwise, so
+ * a plan of a few bins out of 2^30 costs no more than its convolution.
+ *
+ * As in plan<T>, the member functions without a scratch argument use the
+ * scratch buffer of the plan, execute() the one of the caller. in and out
+ * may be the same buffer when n == m. */
+
+template <transform_scalar T>
+class chirp_plan {
+ public:
+  using el_type = T;
+  using value_type = gsl::type::complex_base<el_type>;
+  using size_type = std::size_t;
+
+  /* the DFT of n points */
+  explicit chirp_plan(size_type n) : chirp_plan(n, n, n, 0) {}
+  /* m frequencies (first + j) / bins of n points */
+  chirp_plan(size_type n, size_type m, size_type bins, size_type first);
+
+  size_type size() const { return points; }
+  size_type outputs() const { return post.size(); }
+  /* the length of the convolution */
+  size_type convolution_size() const { return convolution.size(); }
+  size_type scratch_size() const { return 2 * convolution.size(); }
+
+  void forward(std::span<value_type> data) {
+    execute(direction::forward, data, data, work);
+  }
+  void forward(std::span<const value_type> in, std::span<value_type> out) {
+    execute(direction::forward, in, out, work);
+  }
+  void backward(std::span<value_type> data) {
+    execute(direction::backward, data, data, work);
+  }
+  void backward(std::span<const value_type> in, std::span<value_type> out) {
+    execute(direction::backward, in, out, work);
+  }
+  void inverse(std::span<value_type> data) {
+    execute(direction::inverse, data, data, work);
+  }
+  void inverse(std::span<const value_type> in, std::span<value_type> out) {
+    execute(direction::inverse, in, out, work);
+  }
+
+  void execute(direction d, std::span<const value_type> in,
+               std::span<value_type> out,
+               std::span<value_type> scratch) const;
+
+ private:
+  size_type points;
+  size_type bins;
+  plan<T> fft;
+  /* the chirps of the input and the output */
+  std::vector<value_type> pre;
+  std::vector<value_type> post;
+  /* the transform of the convolution chirp, divided by its length */
+  std::vector<value_type> convolution;
+  std::vector<value_type> work;
+};
+
+extern template class chirp_plan<float>;
+extern template class chirp_plan<double>;
+
+}  // namespace gsl::fft
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <gsl/fft/plan.h>
+#include <gsl/type/complex.h>
+
+#include <chrono>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace gsl::fft {
+
+namespace detail {
+class workers;
+}
+
+/* Multidimensional complex transforms
+ *
+ * A grid_plan<T> transforms a row-major grid of complex_base<T>, the last
+ * axis contiguous, of any rank: {rows, columns} for 2D grids, {planes, rows,
+ * columns} for 3D ones. The transform is the 1D transform of plan<T> along
+ * every axis in turn, from the last one to the first, each stage
+ * parallelized over the threads of the plan:
+ *
+ *   last axis    the rows are contiguous and transformed where they are,
+ *                blocks of rows per task
+ *   other axes   the points of an axis are stride apart, every task
+ *                copies a tile of neighbouring columns into a buffer of its
+ *                thread, runs the transforms on the rows of the tile and
+ *                copies it back. A tile is as many columns as fit in 128
+ *                KiB, from one up to four cache lines of each point
+ *
+ * The threads are started with the plan and wait between calls, the caller
+ * runs tasks too. Tiles and scratch buffers are made per thread with the
+ * plan, running it allocates nothing. The result does not depend on the
+ * number of threads. As with plan<T> one grid_plan runs one transform at a
+ * time; the inverse scales every axis, 1 / size() in total. A moved-from
+ * plan has no threads, threads() is 0 and running it throws, it can only
+ * be assigned to or destroyed.
+ *
+ * Every call records the time of each stage, timings() gives them for the
+ * last call: the wall time of the stage and, summed over the threads, the
+ * time spent in the 1D transforms and in copying tiles. */
+
+template <transform_scalar T>
+class grid_plan {
+ public:
+  using el_type = T;
+  using value_type = gsl::type::complex_base<el_type>;
+  using size_type = std::size_t;
+  using duration = std::chrono::nanoseconds;
+
+  struct stage_timing {
+    size_type axis;
+    duration wall;
+    duration transform;
+    duration copy;
+  };
+
+  /* 0 threads: one per hardware thread */
+  explicit grid_plan(std::span<const size_type> shape, size_type threads = 0);
+  explicit grid_plan(std::initializer_list<size_type> shape,
+                     size_type threads = 0)
+      : grid_plan(std::span{shape.begin(), shape.size()}, threads) {}
+  grid_plan(grid_plan&&) noexcept;
+  grid_plan& operator=(grid_plan&&) noexcept;
+  ~grid_plan();
+
+  size_type size() const { return count; }
+  size_type rank() const { return dims.size(); }
+  std::span<const size_type> shape() const { return dims; }
+  size_type threads() const;
+
+  void forward(std::span<value_type> data) {
+    execute(direction::forward, data, data);
+  }
+  void forward(std::span<const value_type> in, std::span<value_type> out) {
+    execute(direction::forward, in, out);
+  }
+  void backward(std::span<value_type> data) {
+    execute(direction::backward, data, data);
+  }
+  void backward(std::span<const value_type> in, std::span<value_type> out) {
+    execute(direction::backward, in, out);
+  }
+  void inverse(std::span<value_type> data) {
+    execute(direction::inverse, data, data);
+  }
+  void inverse(std::span<const value_type> in, std::span<value_type> out) {
+    execute(direction::inverse, in, out);
+  }
+
+  /* the stages of the last call, in the order they ran */
+  std::span<const stage_timing> timings() const { return stages; }
+
+ private:
+  void execute(direction d, std::span<const value_type> in,
+               std::span<value_type> out);
+
+  size_type count;
+  std::vector<size_type> dims;
+  std::vector<plan<T>> plans;
+  /* tile, then scratch, of each thread */
+  size_type buffer_size;
+  std::vector<value_type> buffers;
+  std::vector<stage_timing> stages;
+  /* the times of each thread in the running stage */
+  std::vector<stage_timing> clocks;
+  std::unique_ptr<detail::workers> pool;
+};
+
+extern template class grid_plan<float>;
+extern template class grid_plan<double>;
+
+}  // namespace gsl::fft
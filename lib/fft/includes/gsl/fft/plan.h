@@ -0,0 +1,106 @@
+#pragma once
+
+#include <gsl/type/complex.h>
+
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace gsl::fft {
+
+/* Complex discrete Fourier transforms
+ *
+ *   forward    y[k] = sum_j x[j] exp(-2 pi i j k / n)
+ *   backward   y[k] = sum_j x[j] exp(+2 pi i j k / n)
+ *   inverse    backward / n, inverse(forward(x)) == x
+ *
+ * A plan<T> is made once for a length n whose only prime factors are 2, 3,
+ * 5 and 7 and then run on any number of buffers of n complex_base<T>. It
+ * holds the factorization of n into radix 4, 2, 3, 5 and 7 passes, the
+ * twiddle factors of every pass and a scratch buffer, so running it
+ * allocates nothing. Other lengths throw std::invalid_argument.
+ *
+ * The passes are those of the Stockham autosort algorithm: each reads one
+ * buffer and writes the other, the output comes out in natural order and no
+ * bit reversal is needed. Out of place transforms ping-pong between the
+ * output and the scratch buffer and never write to the input, in place ones
+ * start from the data and copy back from the scratch buffer when the number
+ * of passes is odd. in and out are either the same buffer or do not
+ * overlap.
+ *
+ * The member functions without a scratch argument use the scratch buffer of
+ * the plan, one plan runs one transform at a time. execute() takes the
+ * scratch buffer of the caller (at least scratch_size() elements) and is
+ * const, threads can share a plan that way. */
+
+template <typename T>
+concept transform_scalar = std::same_as<T, float> || std::same_as<T, double>;
+
+enum class direction { forward, backward, inverse };
+
+template <transform_scalar T>
+class plan {
+ public:
+  using el_type = T;
+  using value_type = gsl::type::complex_base<el_type>;
+  using size_type = std::size_t;
+
+  /* the radixes of the passes, in the order they run */
+  constexpr static size_type RADIXES[] = {4, 2, 3, 5, 7};
+
+  explicit plan(size_type n);
+
+  size_type size() const { return length; }
+  size_type scratch_size() const { return length; }
+  std::span<const size_type> factors() const { return radixes; }
+
+  /* true when n is a length plan<T>(n) accepts */
+  static bool supports(size_type n);
+  /* the smallest length from n up that it accepts, for zero padding */
+  static size_type next_size(size_type n);
+
+  void forward(std::span<value_type> data) {
+    execute(direction::forward, data, data, work);
+  }
+  void forward(std::span<const value_type> in, std::span<value_type> out) {
+    execute(direction::forward, in, out, work);
+  }
+  void backward(std::span<value_type> data) {
+    execute(direction::backward, data, data, work);
+  }
+  void backward(std::span<const value_type> in, std::span<value_type> out) {
+    execute(direction::backward, in, out, work);
+  }
+  void inverse(std::span<value_type> data) {
+    execute(direction::inverse, data, data, work);
+  }
+  void inverse(std::span<const value_type> in, std::span<value_type> out) {
+    execute(direction::inverse, in, out, work);
+  }
+
+  void execute(direction d, std::span<const value_type> in,
+               std::span<value_type> out,
+               std::span<value_type> scratch) const;
+
+ private:
+  /* one pass: radix butterflies over sub-transforms of the given length,
+   * stride apart, with the twiddles at twiddles[offset] */
+  struct pass {
+    size_type radix;
+    size_type length;
+    size_type stride;
+    size_type offset;
+  };
+
+  size_type length;
+  std::vector<size_type> radixes;
+  std::vector<pass> passes;
+  std::vector<value_type> twiddles;
+  std::vector<value_type> work;
+};
+
+extern template class plan<float>;
+extern template class plan<double>;
+
+}  // namespace gsl::fft
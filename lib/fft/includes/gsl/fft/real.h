@@ -0,0 +1,108 @@
+#pragma once
+
+#include <gsl/fft/plan.h>
+#include <gsl/type/complex.h>
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace gsl::fft {
+
+/* Transforms of real sequences
+ *
+ * The forward transform X of n real points is hermitian, X[n - k] is the
+ * conjugate of X[k], so only its first n / 2 + 1 points are stored:
+ *
+ *   forward    n real points -> n / 2 + 1 complex_base<T>
+ *   backward   n / 2 + 1 complex_base<T> -> n real points, the sign and the
+ *              scale of plan<T>::backward, the imaginary parts of X[0] and,
+ *              for even n, X[n / 2] are ignored
+ *   inverse    backward / n
+ *
+ * For even n the n real points are taken as n / 2 complex ones, even points
+ * in the real parts and odd ones in the imaginary parts, and go through a
+ * plan<T> of length n / 2; one pass over k and n / 2 - k splits the result
+ * into the transforms of the even and the odd points and combines them with
+ * the twiddles exp(-2 pi i k / n). The forward transform runs in the output
+ * buffer, the backward one in the real output seen as complex_base<T>. Odd
+ * lengths take a complex plan of length n on the real points made complex.
+ * The lengths are those of plan<T>.
+ *
+ * The halfcomplex functions read and write the packed layout of the GSL
+ * real transforms instead, n reals
+ *
+ *   Re X[0], Re X[1], Im X[1], ..., Re X[(n - 1) / 2], Im X[(n - 1) / 2]
+ *
+ * followed by Re X[n / 2] for even n. They take the same buffer as input
+ * and output.
+ *
+ * As in plan<T>, the member functions without a scratch argument use the
+ * buffers of the plan, execute() the one of the caller. The real and
+ * complex buffers of a call do not overlap. */
+
+template <transform_scalar T>
+class real_plan {
+ public:
+  using el_type = T;
+  using value_type = gsl::type::complex_base<el_type>;
+  using size_type = std::size_t;
+
+  explicit real_plan(size_type n);
+
+  size_type size() const { return length; }
+  size_type spectrum_size() const { return length / 2 + 1; }
+  size_type scratch_size() const {
+    return length % 2 == 0 ? length / 2 : 2 * length;
+  }
+
+  static bool supports(size_type n) { return plan<T>::supports(n); }
+
+  void forward(std::span<const el_type> in, std::span<value_type> out) {
+    execute(in, out, scratch());
+  }
+  void backward(std::span<const value_type> in, std::span<el_type> out) {
+    execute(direction::backward, in, out, scratch());
+  }
+  void inverse(std::span<const value_type> in, std::span<el_type> out) {
+    execute(direction::inverse, in, out, scratch());
+  }
+
+  void forward_halfcomplex(std::span<el_type> data);
+  void backward_halfcomplex(std::span<el_type> data);
+  void inverse_halfcomplex(std::span<el_type> data);
+
+  /* forward */
+  void execute(std::span<const el_type> in, std::span<value_type> out,
+               std::span<value_type> scratch) const;
+  /* backward or inverse */
+  void execute(direction d, std::span<const value_type> in,
+               std::span<el_type> out, std::span<value_type> scratch) const;
+
+ private:
+  std::span<value_type> scratch() {
+    return std::span{work}.first(scratch_size());
+  }
+  std::span<value_type> spectrum() {
+    return std::span{work}.subspan(scratch_size());
+  }
+
+  size_type length;
+  plan<T> half;
+  /* exp(-2 pi i k / n), k = 0 .. n / 4, even lengths */
+  std::vector<value_type> twiddles;
+  std::vector<value_type> work;
+};
+
+extern template class real_plan<float>;
+extern template class real_plan<double>;
+
+/* n / 2 + 1 points of a hermitian transform <-> its n halfcomplex reals */
+template <transform_scalar T>
+void pack_halfcomplex(std::span<const gsl::type::complex_base<T>> spectrum,
+                      std::span<T> packed);
+template <transform_scalar T>
+void unpack_halfcomplex(std::span<const T> packed,
+                        std::span<gsl::type::complex_base<T>> spectrum);
+
+}  // namespace gsl::fft
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <gsl/fft/plan.h>
+#include <gsl/type/complex.h>
+
+#include <cstddef>
+#include <memory>
+#include <span>
+
+namespace gsl::fft {
+
+/* Shared tables of roots of unity
+ *
+ * roots<T>(n) gives the table w[k] = exp(-2 pi i k / n), k < n, of
+ * complex_base<T>; exp(2 pi i k / n) is its conjugate. Every entry is
+ * computed on its own, not by recurrence: k is split into quarter turns,
+ * which are exact, and an angle of at most pi / 4 whose sin and cos are
+ * evaluated in double_double and rounded once to T, so the entries are
+ * correctly rounded but for values within 2^-100 of a tie.
+ *
+ * The tables are kept in a process wide cache, one per n and T, that the
+ * plans of gsl/fft share for their twiddles. A lookup of a cached table
+ * is an acquire load of a slot of a fixed open addressed array (about one
+ * for most n) and never locks; the first lookup of an n builds the table
+ * under a mutex, which only the other first lookups wait for. Cached
+ * tables are never freed or changed, a roots<T> handle to one is a
+ * pointer and the entries stay valid for the life of the process.
+ *
+ * The cache holds at most roots_cache::budget() bytes of tables and
+ * SLOTS tables per T. A table that does not fit is built for the handle
+ * that asked for it, owned by it and freed with it, without taking the
+ * mutex; roots_cache::stats() reports the bytes and tables cached and the
+ * tables built outside. */
+
+namespace detail {
+
+/* the entry k of the table of n on its own, for the few entries of an n
+ * too large to build */
+template <transform_scalar T>
+gsl::type::complex_base<T> root(std::size_t k, std::size_t n);
+
+}  // namespace detail
+
+template <transform_scalar T>
+class roots_table;
+
+template <transform_scalar T>
+class roots {
+ public:
+  using el_type = T;
+  using value_type = gsl::type::complex_base<el_type>;
+  using size_type = std::size_t;
+
+  explicit roots(size_type n);
+  roots(roots&&) noexcept;
+  roots& operator=(roots&&) noexcept;
+  ~roots();
+
+  size_type size() const { return entries.size(); }
+  std::span<const value_type> values() const { return entries; }
+  const value_type& operator[](size_type k) const { return entries[k]; }
+  /* false for a table the cache had no room for */
+  bool cached() const { return owned == nullptr; }
+
+ private:
+  std::span<const value_type> entries;
+  std::unique_ptr<const roots_table<T>> owned;
+};
+
+extern template class roots<float>;
+extern template class roots<double>;
+
+struct roots_cache {
+  /* open addressed slots per precision */
+  constexpr static std::size_t SLOTS = 128;
+  constexpr static std::size_t DEFAULT_BUDGET = 64 << 20;
+
+  struct usage {
+    std::size_t bytes;
+    std::size_t tables;
+    std::size_t uncached;
+    std::size_t budget;
+  };
+
+  static usage stats();
+  static std::size_t budget();
+  /* for the tables cached from now on, the cached ones stay */
+  static void set_budget(std::size_t bytes);
+};
+
+}  // namespace gsl::fft
@@ -0,0 +1,125 @@
+/* Chirp-z transforms of gsl/fft/chirp.h */
+
+#include <gsl/fft/chirp.h>
+#include <gsl/fft/roots.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <stdexcept>
+
+namespace gsl::fft {
+namespace {
+
+using std::size_t;
+
+template <typename T>
+size_t convolution_length(size_t n, size_t m, size_t bins) {
+  if (n == 0 || m == 0 || bins == 0) {
+    throw std::invalid_argument("gsl::fft::chirp_plan: empty transform");
+  }
+  return plan<T>::next_size(n + m - 1);
+}
+
+/* t^2 + 2 c t modulo 2 bins for t = 0, 1, ..., from the differences
+ * 2 t + 1 + 2 c, every value stays below 2 bins */
+class phase {
+ public:
+  phase(size_t c, size_t bins)
+      : modulus{2 * bins}, step{(2 * (c % bins) + 1) % modulus} {}
+
+  size_t operator()() {
+    const auto q = value;
+    value += step;
+    if (value >= modulus) value -= modulus;
+    step += 2;
+    if (step >= modulus) step -= modulus;
+    return q;
+  }
+
+ private:
+  size_t modulus;
+  size_t step;
+  size_t value = 0;
+};
+
+}  // namespace
+
+template <transform_scalar T>
+chirp_plan<T>::chirp_plan(size_type n, size_type m, size_type bins,
+                          size_type first)
+    : points{n},
+      bins{bins},
+      fft{convolution_length<T>(n, m, bins)},
+      pre(n),
+      post(m),
+      convolution(fft.size()),
+      work(scratch_size()) {
+  /* the n + max(n, m) factors are entries of the roots of 2 bins. Their
+   * table is read when it costs about what the convolution does, a zoom
+   * into a few bins of a long transform computes each factor on its own */
+  const auto modulus = 2 * bins;
+  std::optional<roots<T>> table;
+  if (modulus <= 2 * fft.size()) table.emplace(modulus);
+  const auto w = [&](size_t k) {
+    return table ? (*table)[k] : detail::root<T>(k, modulus);
+  };
+  phase modulated(first, bins);
+  for (auto& z : pre) z = w(modulated());
+
+  /* post[j] = exp(-i pi j^2 / bins) and its conjugate, the convolution
+   * chirp, at j for the outputs and at -j for the inputs */
+  const auto l = convolution.size();
+  phase square(0, bins);
+  for (size_type j = 0; j < std::max(n, m); j++) {
+    const auto c = w(square());
+    if (j < m) {
+      post[j] = c;
+      convolution[j] = c.congugate();
+    }
+    if (j > 0 && j < n) convolution[l - j] = c.congugate();
+  }
+  fft.execute(direction::forward, convolution, convolution, work);
+  const auto f = T(1) / static_cast<T>(l);
+  for (auto& z : convolution) z = z * f;
+}
+
+template <transform_scalar T>
+void chirp_plan<T>::execute(direction d, std::span<const value_type> in,
+                            std::span<value_type> out,
+                            std::span<value_type> scratch) const {
+  if (in.size() != points || out.size() != outputs()) {
+    throw std::invalid_argument("gsl::fft::chirp_plan::execute: buffer length");
+  }
+  if (scratch.size() < scratch_size()) {
+    throw std::invalid_argument(
+        "gsl::fft::chirp_plan::execute: scratch length");
+  }
+
+  /* the backward transform is the conjugate of the forward one of the
+   * conjugate input */
+  const bool conjugate = d != direction::forward;
+  const auto l = convolution.size();
+  const auto a = scratch.first(l);
+  const auto rest = scratch.subspan(l, l);
+  for (size_type t = 0; t < points; t++) {
+    a[t] = (conjugate ? in[t].congugate() : in[t]) * pre[t];
+  }
+  std::fill(a.begin() + points, a.end(), value_type{});
+
+  fft.execute(direction::forward, a, a, rest);
+  for (size_type i = 0; i < l; i++) a[i] = a[i] * convolution[i];
+  fft.execute(direction::backward, a, a, rest);
+
+  const auto f = d == direction::inverse ? T(1) / static_cast<T>(bins)
+                                         : T(1);
+  for (size_type j = 0; j < out.size(); j++) {
+    const auto y = post[j] * a[j];
+    out[j] = (conjugate ? y.congugate() : y) * f;
+  }
+}
+
+template class chirp_plan<float>;
+template class chirp_plan<double>;
+
+}  // namespace gsl::fft
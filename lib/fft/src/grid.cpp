@@ -0,0 +1,241 @@
+/* Threads and stages of gsl/fft/grid.h */
+
+#include <gsl/fft/grid.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+
+namespace gsl::fft {
+namespace detail {
+
+/* n - 1 threads that wait for a task and run it with their index, the
+ * caller runs it as thread 0; run() returns when every thread is done */
+class workers {
+ public:
+  explicit workers(std::size_t n) {
+    for (std::size_t i = 1; i < n; i++) {
+      threads.emplace_back([this, i] { loop(i); });
+    }
+  }
+
+  ~workers() {
+    {
+      std::lock_guard lock(m);
+      stop = true;
+    }
+    wake.notify_all();
+    for (auto& t : threads) t.join();
+  }
+
+  std::size_t size() const { return threads.size() + 1; }
+
+  template <typename F>
+  void run(F& f) {
+    {
+      std::lock_guard lock(m);
+      task = [](void* c, std::size_t i) { (*static_cast<F*>(c))(i); };
+      context = &f;
+      pending = threads.size();
+      generation++;
+    }
+    wake.notify_all();
+    f(0);
+    std::unique_lock lock(m);
+    done.wait(lock, [this] { return pending == 0; });
+  }
+
+ private:
+  void loop(std::size_t index) {
+    std::uint64_t seen = 0;
+    std::unique_lock lock(m);
+    for (;;) {
+      wake.wait(lock, [&] { return stop || generation != seen; });
+      if (stop) return;
+      seen = generation;
+      const auto f = task;
+      const auto c = context;
+      lock.unlock();
+      f(c, index);
+      lock.lock();
+      if (--pending == 0) done.notify_one();
+    }
+  }
+
+  std::mutex m;
+  std::condition_variable wake;
+  std::condition_variable done;
+  void (*task)(void*, std::size_t) = nullptr;
+  void* context = nullptr;
+  std::uint64_t generation = 0;
+  std::size_t pending = 0;
+  bool stop = false;
+  std::vector<std::thread> threads;
+};
+
+}  // namespace detail
+
+namespace {
+
+using steady = std::chrono::steady_clock;
+
+/* points of the last axis per task */
+constexpr std::size_t ROW_BLOCK = 16384;
+/* bytes of a tile of the other axes */
+constexpr std::size_t TILE_BYTES = 128 * 1024;
+constexpr std::size_t CACHE_LINE = 64;
+
+/* columns per tile: as many as stay within TILE_BYTES, up to four cache
+ * lines of every point of the axis and at most the columns there are. A
+ * long axis takes less than a line, down to a single column, rather than
+ * a tile that no longer fits the cache */
+template <typename V>
+std::size_t tile_columns(std::size_t length, std::size_t stride) {
+  const auto line = std::max<std::size_t>(1, CACHE_LINE / sizeof(V));
+  const auto fit = TILE_BYTES / (length * sizeof(V));
+  return std::min({std::max<std::size_t>(1, fit), 4 * line, stride});
+}
+
+}  // namespace
+
+template <transform_scalar T>
+grid_plan<T>::grid_plan(std::span<const size_type> shape, size_type threads)
+    : dims(shape.begin(), shape.end()) {
+  if (dims.empty()) {
+    throw std::invalid_argument("gsl::fft::grid_plan: rank 0");
+  }
+  count = std::accumulate(dims.begin(), dims.end(), size_type{1},
+                          std::multiplies<>{});
+  plans.reserve(dims.size());
+  for (const auto n : dims) plans.emplace_back(n);
+
+  buffer_size = 0;
+  for (size_type a = 0, stride = count; a < dims.size(); a++) {
+    stride /= dims[a];
+    const auto tile = a + 1 < dims.size()
+                          ? tile_columns<value_type>(dims[a], stride) * dims[a]
+                          : 0;
+    buffer_size = std::max(buffer_size, tile + plans[a].scratch_size());
+  }
+
+  if (threads == 0) {
+    threads = std::max<size_type>(1, std::thread::hardware_concurrency());
+  }
+  buffers.resize(threads * buffer_size);
+  stages.reserve(dims.size());
+  clocks.resize(threads);
+  pool = std::make_unique<detail::workers>(threads);
+}
+
+template <transform_scalar T>
+grid_plan<T>::grid_plan(grid_plan&&) noexcept = default;
+template <transform_scalar T>
+grid_plan<T>& grid_plan<T>::operator=(grid_plan&&) noexcept = default;
+template <transform_scalar T>
+grid_plan<T>::~grid_plan() = default;
+
+template <transform_scalar T>
+typename grid_plan<T>::size_type grid_plan<T>::threads() const {
+  return pool ? pool->size() : 0;
+}
+
+template <transform_scalar T>
+void grid_plan<T>::execute(direction d, std::span<const value_type> in,
+                           std::span<value_type> out) {
+  if (!pool) throw std::invalid_argument("gsl::fft::grid_plan: moved from");
+  if (in.size() != count || out.size() != count) {
+    throw std::invalid_argument("gsl::fft::grid_plan: buffer length");
+  }
+
+  stages.clear();
+  auto* data = out.data();
+
+  for (size_type s = 0, stride = 1; s < dims.size(); s++) {
+    const auto a = dims.size() - 1 - s;
+    const auto length = dims[a];
+    const auto& p = plans[a];
+    std::atomic<size_type> next{0};
+    for (auto& c : clocks) c = {a, {}, {}, {}};
+
+    const auto start = steady::now();
+    if (s == 0) {
+      /* rows, from in to out */
+      const auto rows = count / length;
+      const auto block = std::max<size_type>(1, ROW_BLOCK / length);
+      const auto tasks = (rows + block - 1) / block;
+      auto task = [&](size_type i) {
+        const auto buffer = std::span{buffers}.subspan(i * buffer_size,
+                                                       buffer_size);
+        const auto scratch = buffer.last(p.scratch_size());
+        for (size_type t; (t = next++) < tasks;) {
+          const auto t0 = steady::now();
+          const auto end = std::min(rows, (t + 1) * block);
+          for (auto r = t * block; r < end; r++) {
+            p.execute(d, in.subspan(r * length, length),
+                      out.subspan(r * length, length), scratch);
+          }
+          clocks[i].transform += steady::now() - t0;
+        }
+      };
+      pool->run(task);
+    } else {
+      /* tiles of columns stride apart, in place in out */
+      const auto outer = count / (length * stride);
+      const auto width = tile_columns<value_type>(length, stride);
+      const auto blocks = (stride + width - 1) / width;
+      const auto tasks = outer * blocks;
+      auto task = [&](size_type i) {
+        const auto buffer = std::span{buffers}.subspan(i * buffer_size,
+                                                       buffer_size);
+        const auto scratch = buffer.last(p.scratch_size());
+        auto* tile = buffer.data();
+        for (size_type t; (t = next++) < tasks;) {
+          const auto column = t % blocks * width;
+          const auto w = std::min(width, stride - column);
+          auto* base = data + t / blocks * length * stride + column;
+
+          const auto t0 = steady::now();
+          for (size_type j = 0; j < length; j++) {
+            for (size_type c = 0; c < w; c++) {
+              tile[c * length + j] = base[j * stride + c];
+            }
+          }
+          const auto t1 = steady::now();
+          for (size_type c = 0; c < w; c++) {
+            const auto row = buffer.subspan(c * length, length);
+            p.execute(d, row, row, scratch);
+          }
+          const auto t2 = steady::now();
+          for (size_type j = 0; j < length; j++) {
+            for (size_type c = 0; c < w; c++) {
+              base[j * stride + c] = tile[c * length + j];
+            }
+          }
+          clocks[i].copy += (t1 - t0) + (steady::now() - t2);
+          clocks[i].transform += t2 - t1;
+        }
+      };
+      pool->run(task);
+    }
+
+    stages.push_back({a, steady::now() - start, {}, {}});
+    auto& stage = stages.back();
+    for (const auto& c : clocks) {
+      stage.transform += c.transform;
+      stage.copy += c.copy;
+    }
+    stride *= length;
+  }
+}
+
+template class grid_plan<float>;
+template class grid_plan<double>;
+
+}  // namespace gsl::fft
@@ -0,0 +1,238 @@
+/* Mixed radix Stockham passes of gsl/fft/plan.h
+ *
+ * A pass of radix R over sub-transforms of length L = R m, stride s apart,
+ * reads the R points x[q + s (p + k m)], k = 0 .. R - 1, of every p < m and
+ * q < s, runs a length R DFT on them, multiplies output j by the twiddle
+ * w_L^(j p) and writes it to y[q + s (R p + j)]. The next pass works on the
+ * sub-transforms of length m with stride s R; after the last one the
+ * transform is in natural order. */
+
+#include <gsl/fft/plan.h>
+#include <gsl/fft/roots.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+
+namespace gsl::fft {
+namespace {
+
+using std::size_t;
+using gsl::type::complex_base;
+
+/* z (-i) in forward transforms, z i in backward ones */
+template <bool Backward, typename T>
+complex_base<T> rotate(const complex_base<T>& z) {
+  if constexpr (Backward) {
+    return {-z.img(), z.real()};
+  } else {
+    return {z.img(), -z.real()};
+  }
+}
+
+template <bool Backward, typename T>
+complex_base<T> twiddle(const complex_base<T>& z, const complex_base<T>& w) {
+  if constexpr (Backward) {
+    return z * w.congugate();
+  } else {
+    return z * w;
+  }
+}
+
+/* cos and sin of 2 pi k / R, k = 1 .. R / 2, for the odd radixes */
+template <size_t R>
+struct radix_roots;
+
+template <>
+struct radix_roots<3> {
+  constexpr static long double cos[] = {-0.5L};
+  constexpr static long double sin[] = {0.866025403784438646763723L};
+};
+
+template <>
+struct radix_roots<5> {
+  constexpr static long double cos[] = {0.309016994374947424102293L,
+                                        -0.809016994374947424102293L};
+  constexpr static long double sin[] = {0.951056516295153572116439L,
+                                        0.587785252292473129168706L};
+};
+
+template <>
+struct radix_roots<7> {
+  constexpr static long double cos[] = {0.623489801858733530525005L,
+                                        -0.222520933956314404288903L,
+                                        -0.900968867902419126236102L};
+  constexpr static long double sin[] = {0.781831482468029808708445L,
+                                        0.974927912181823607018132L,
+                                        0.433883739117558120475768L};
+};
+
+/* a[j] = sum_k a[k] w^(j k), w = exp(-2 pi i / R), exp(2 pi i / R) in
+ * backward transforms */
+template <size_t R, bool Backward, typename T>
+void butterfly(complex_base<T>* a) {
+  if constexpr (R == 2) {
+    const auto t = a[0] - a[1];
+    a[0] = a[0] + a[1];
+    a[1] = t;
+  } else if constexpr (R == 4) {
+    const auto t0 = a[0] + a[2];
+    const auto t1 = a[0] - a[2];
+    const auto t2 = a[1] + a[3];
+    const auto t3 = rotate<Backward>(a[1] - a[3]);
+    a[0] = t0 + t2;
+    a[1] = t1 + t3;
+    a[2] = t0 - t2;
+    a[3] = t1 - t3;
+  } else {
+    /* outputs j and R - j share the cos terms of the sums a[k] + a[R - k]
+     * and have opposite sin terms of the differences a[k] - a[R - k] */
+    constexpr size_t H = R / 2;
+    complex_base<T> s[H];
+    complex_base<T> d[H];
+    auto b0 = a[0];
+    for (size_t k = 1; k <= H; k++) {
+      s[k - 1] = a[k] + a[R - k];
+      d[k - 1] = a[k] - a[R - k];
+      b0 = b0 + s[k - 1];
+    }
+    for (size_t j = 1; j <= H; j++) {
+      auto c = a[0];
+      complex_base<T> n;
+      for (size_t k = 1; k <= H; k++) {
+        const auto i = j * k % R;
+        const auto f = i <= H ? i : R - i;
+        const auto sin = static_cast<T>(radix_roots<R>::sin[f - 1]);
+        c = c + s[k - 1] * static_cast<T>(radix_roots<R>::cos[f - 1]);
+        n = n + d[k - 1] * (i <= H ? sin : -sin);
+      }
+      n = rotate<Backward>(n);
+      a[j] = c + n;
+      a[R - j] = c - n;
+    }
+    a[0] = b0;
+  }
+}
+
+template <size_t R, bool Backward, typename T>
+void radix_pass(size_t length, size_t stride, const complex_base<T>* w,
+                const complex_base<T>* x, complex_base<T>* y) {
+  const auto m = length / R;
+  for (size_t p = 0; p < m; p++, w += R - 1) {
+    for (size_t q = 0; q < stride; q++) {
+      complex_base<T> a[R];
+      for (size_t k = 0; k < R; k++) {
+        a[k] = x[q + stride * (p + k * m)];
+      }
+      butterfly<R, Backward>(a);
+      auto* o = y + q + stride * R * p;
+      o[0] = a[0];
+      for (size_t j = 1; j < R; j++) {
+        o[stride * j] = twiddle<Backward>(a[j], w[j - 1]);
+      }
+    }
+  }
+}
+
+template <bool Backward, typename T>
+void run_pass(size_t radix, size_t length, size_t stride,
+              const complex_base<T>* w, const complex_base<T>* x,
+              complex_base<T>* y) {
+  switch (radix) {
+    case 2:
+      return radix_pass<2, Backward>(length, stride, w, x, y);
+    case 3:
+      return radix_pass<3, Backward>(length, stride, w, x, y);
+    case 4:
+      return radix_pass<4, Backward>(length, stride, w, x, y);
+    case 5:
+      return radix_pass<5, Backward>(length, stride, w, x, y);
+    default:
+      return radix_pass<7, Backward>(length, stride, w, x, y);
+  }
+}
+
+}  // namespace
+
+template <transform_scalar T>
+bool plan<T>::supports(size_type n) {
+  if (n == 0) return false;
+  for (const auto r : RADIXES) {
+    while (n % r == 0) n /= r;
+  }
+  return n == 1;
+}
+
+template <transform_scalar T>
+typename plan<T>::size_type plan<T>::next_size(size_type n) {
+  while (!supports(n)) n++;
+  return n;
+}
+
+template <transform_scalar T>
+plan<T>::plan(size_type n) : length{n} {
+  if (!supports(n)) {
+    throw std::invalid_argument(
+        "gsl::fft::plan: length is 0 or has a prime factor above 7");
+  }
+  for (const auto r : RADIXES) {
+    for (; n % r == 0; n /= r) radixes.push_back(r);
+  }
+
+  /* w_l^(j p) = w_n^(j p n / l), the twiddles of every pass come from the
+   * shared table of n and are copied in the order the pass reads them */
+  const roots<T> w(length);
+  size_type stride = 1;
+  for (auto l = length; const auto r : radixes) {
+    passes.push_back({r, l, stride, twiddles.size()});
+    for (size_type p = 0; p < l / r; p++) {
+      for (size_type j = 1; j < r; j++) {
+        twiddles.push_back(w[j * p * stride]);
+      }
+    }
+    stride *= r;
+    l /= r;
+  }
+  work.resize(scratch_size());
+}
+
+template <transform_scalar T>
+void plan<T>::execute(direction d, std::span<const value_type> in,
+                      std::span<value_type> out,
+                      std::span<value_type> scratch) const {
+  if (in.size() != length || out.size() != length) {
+    throw std::invalid_argument("gsl::fft::plan::execute: buffer length");
+  }
+  if (scratch.size() < scratch_size()) {
+    throw std::invalid_argument("gsl::fft::plan::execute: scratch length");
+  }
+
+  /* the last pass writes out when the input can be overwritten, the first
+   * one scratch when it can not */
+  const bool in_place = in.data() == out.data();
+  const auto count = passes.size();
+  const auto* x = in.data();
+  for (size_type i = 0; i < count; i++) {
+    const bool to_out = in_place ? i % 2 == 1 : (count - 1 - i) % 2 == 0;
+    auto* y = to_out ? out.data() : scratch.data();
+    const auto& s = passes[i];
+    const auto* w = twiddles.data() + s.offset;
+    if (d == direction::forward) {
+      run_pass<false>(s.radix, s.length, s.stride, w, x, y);
+    } else {
+      run_pass<true>(s.radix, s.length, s.stride, w, x, y);
+    }
+    x = y;
+  }
+  if (x != out.data()) std::copy_n(x, length, out.data());
+
+  if (d == direction::inverse) {
+    const auto f = T(1) / static_cast<T>(length);
+    for (auto& z : out) z = z * f;
+  }
+}
+
+template class plan<float>;
+template class plan<double>;
+
+}  // namespace gsl::fft
@@ -0,0 +1,200 @@
+/* Real transforms of gsl/fft/real.h
+ *
+ * With z[j] = x[2 j] + i x[2 j + 1], j < h = n / 2, and Z its length h
+ * transform, the transforms of the even and odd points are
+ *
+ *   E[k] = (Z[k] + conj Z[h - k]) / 2
+ *   O[k] = (Z[k] - conj Z[h - k]) / 2i
+ *
+ * and X[k] = E[k] + w^k O[k], w = exp(-2 pi i / n). Points k and h - k are
+ * done together, E[h - k] = conj E[k], O[h - k] = conj O[k] and w^(h - k) =
+ * -conj w^k, so the twiddles are stored up to k = h / 2 and the split runs
+ * in place. The backward transform rebuilds 2 Z[k] = E[k] + i O[k] from
+ * E[k] = X[k] + conj X[h - k], O[k] = (X[k] - conj X[h - k]) conj w^k and
+ * runs the backward length h transform on it, which gives n z. */
+
+#include <gsl/fft/real.h>
+#include <gsl/fft/roots.h>
+#include <gsl/type/complex_view.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+
+namespace gsl::fft {
+namespace {
+
+using std::size_t;
+using gsl::type::complex_base;
+
+template <typename T>
+size_t half_length(size_t n) {
+  if (!plan<T>::supports(n)) {
+    throw std::invalid_argument(
+        "gsl::fft::real_plan: length is 0 or has a prime factor above 7");
+  }
+  return n % 2 == 0 ? n / 2 : n;
+}
+
+/* z i */
+template <typename T>
+complex_base<T> times_i(const complex_base<T>& z) {
+  return {-z.img(), z.real()};
+}
+
+}  // namespace
+
+template <transform_scalar T>
+real_plan<T>::real_plan(size_type n) : length{n}, half{half_length<T>(n)} {
+  if (length % 2 == 0) {
+    const roots<T> w(length);
+    twiddles.assign(w.values().begin(), w.values().begin() + length / 4 + 1);
+  }
+  work.resize(scratch_size() + spectrum_size());
+}
+
+template <transform_scalar T>
+void real_plan<T>::execute(std::span<const el_type> in,
+                           std::span<value_type> out,
+                           std::span<value_type> scratch) const {
+  if (in.size() != length || out.size() != spectrum_size()) {
+    throw std::invalid_argument("gsl::fft::real_plan::execute: buffer length");
+  }
+  if (scratch.size() < scratch_size()) {
+    throw std::invalid_argument(
+        "gsl::fft::real_plan::execute: scratch length");
+  }
+
+  if (length % 2 == 1) {
+    const auto z = scratch.first(length);
+    std::copy(in.begin(), in.end(), z.begin());
+    half.execute(direction::forward, z, z, scratch.subspan(length));
+    std::copy_n(z.begin(), out.size(), out.begin());
+    return;
+  }
+
+  const auto h = length / 2;
+  half.execute(direction::forward, gsl::type::as_complex(in.data(), h),
+               out.first(h), scratch);
+
+  const auto z0 = out[0];
+  out[0] = {z0.real() + z0.img(), 0};
+  out[h] = {z0.real() - z0.img(), 0};
+  for (size_type k = 1; 2 * k <= h; k++) {
+    const auto a = out[k];
+    const auto b = out[h - k].congugate();
+    const auto e = (a + b) * T(0.5);
+    const auto o = times_i(b - a) * T(0.5);
+    const auto w = twiddles[k];
+    out[k] = e + w * o;
+    out[h - k] = e.congugate() - w.congugate() * o.congugate();
+  }
+}
+
+template <transform_scalar T>
+void real_plan<T>::execute(direction d, std::span<const value_type> in,
+                           std::span<el_type> out,
+                           std::span<value_type> scratch) const {
+  if (d == direction::forward) {
+    throw std::invalid_argument(
+        "gsl::fft::real_plan::execute: complex to real is backward");
+  }
+  if (in.size() != spectrum_size() || out.size() != length) {
+    throw std::invalid_argument("gsl::fft::real_plan::execute: buffer length");
+  }
+  if (scratch.size() < scratch_size()) {
+    throw std::invalid_argument(
+        "gsl::fft::real_plan::execute: scratch length");
+  }
+  const auto f = d == direction::inverse ? T(1) / static_cast<T>(length)
+                                         : T(1);
+
+  if (length % 2 == 1) {
+    const auto z = scratch.first(length);
+    z[0] = in[0].real();
+    for (size_type k = 1; k < in.size(); k++) {
+      z[k] = in[k];
+      z[length - k] = in[k].congugate();
+    }
+    half.execute(direction::backward, z, z, scratch.subspan(length));
+    for (size_type j = 0; j < length; j++) out[j] = z[j].real() * f;
+    return;
+  }
+
+  const auto h = length / 2;
+  const auto z = gsl::type::as_complex(out.data(), h);
+  z[0] = {in[0].real() + in[h].real(), in[0].real() - in[h].real()};
+  for (size_type k = 1; 2 * k <= h; k++) {
+    const auto a = in[k];
+    const auto b = in[h - k].congugate();
+    const auto e = a + b;
+    const auto o = (a - b) * twiddles[k].congugate();
+    z[k] = e + times_i(o);
+    z[h - k] = e.congugate() + times_i(o.congugate());
+  }
+  half.execute(direction::backward, z, z, scratch);
+  if (d == direction::inverse) {
+    for (auto& x : out) x *= f;
+  }
+}
+
+template <transform_scalar T>
+void real_plan<T>::forward_halfcomplex(std::span<el_type> data) {
+  execute(data, spectrum(), scratch());
+  pack_halfcomplex<T>(spectrum(), data);
+}
+
+template <transform_scalar T>
+void real_plan<T>::backward_halfcomplex(std::span<el_type> data) {
+  unpack_halfcomplex<T>(data, spectrum());
+  execute(direction::backward, spectrum(), data, scratch());
+}
+
+template <transform_scalar T>
+void real_plan<T>::inverse_halfcomplex(std::span<el_type> data) {
+  unpack_halfcomplex<T>(data, spectrum());
+  execute(direction::inverse, spectrum(), data, scratch());
+}
+
+template <transform_scalar T>
+void pack_halfcomplex(std::span<const complex_base<T>> spectrum,
+                      std::span<T> packed) {
+  const auto n = packed.size();
+  if (n == 0 || spectrum.size() != n / 2 + 1) {
+    throw std::invalid_argument("gsl::fft::pack_halfcomplex: length");
+  }
+  packed[0] = spectrum[0].real();
+  for (std::size_t k = 1; 2 * k < n; k++) {
+    packed[2 * k - 1] = spectrum[k].real();
+    packed[2 * k] = spectrum[k].img();
+  }
+  if (n % 2 == 0) packed[n - 1] = spectrum[n / 2].real();
+}
+
+template <transform_scalar T>
+void unpack_halfcomplex(std::span<const T> packed,
+                        std::span<complex_base<T>> spectrum) {
+  const auto n = packed.size();
+  if (n == 0 || spectrum.size() != n / 2 + 1) {
+    throw std::invalid_argument("gsl::fft::unpack_halfcomplex: length");
+  }
+  spectrum[0] = packed[0];
+  for (std::size_t k = 1; 2 * k < n; k++) {
+    spectrum[k] = {packed[2 * k - 1], packed[2 * k]};
+  }
+  if (n % 2 == 0) spectrum[n / 2] = packed[n - 1];
+}
+
+template class real_plan<float>;
+template class real_plan<double>;
+
+template void pack_halfcomplex(std::span<const complex_base<float>>,
+                               std::span<float>);
+template void pack_halfcomplex(std::span<const complex_base<double>>,
+                               std::span<double>);
+template void unpack_halfcomplex(std::span<const float>,
+                                 std::span<complex_base<float>>);
+template void unpack_halfcomplex(std::span<const double>,
+                                 std::span<complex_base<double>>);
+
+}  // namespace gsl::fft
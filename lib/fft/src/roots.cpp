@@ -0,0 +1,209 @@
+/* The roots of unity cache of gsl/fft/roots.h */
+
+#include <gsl/fft/roots.h>
+#include <gsl/math/double_double.h>
+#include <gsl/math/sincos.h>
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace gsl::fft {
+
+template <transform_scalar T>
+class roots_table {
+ public:
+  explicit roots_table(std::size_t n);
+
+  std::vector<gsl::type::complex_base<T>> values;
+};
+
+namespace {
+
+using std::size_t;
+using gsl::math::double_double;
+using gsl::type::complex_base;
+
+constexpr double_double HALF_PI{0x1.921fb54442d18p+0, 0x1.1a62633145c07p-54};
+
+/* x rounded once to T: hi is x rounded to double, a float that rounding hi
+ * puts on a tie is moved to the side of lo */
+template <typename T>
+T narrow(const double_double& x) {
+  if constexpr (std::same_as<T, double>) {
+    return x.hi();
+  } else {
+    auto f = static_cast<T>(x.hi());
+    const double e = x.hi() - f;
+    if (e != 0 && x.lo() != 0 && (x.lo() > 0) == (e > 0)) {
+      const auto g =
+          std::nextafter(f, e > 0 ? std::numeric_limits<T>::infinity()
+                                  : -std::numeric_limits<T>::infinity());
+      if (2 * e == static_cast<double>(g) - f) f = g;
+    }
+    return f;
+  }
+}
+
+template <typename T>
+using slots = std::array<std::atomic<const roots_table<T>*>,
+                         roots_cache::SLOTS>;
+
+/* constant initialized, a lookup reads no guard. The mutex orders the
+ * inserts, the counters are atomic for the lookups that do not take it */
+struct registry {
+  std::mutex m;
+  std::atomic<size_t> bytes = 0;
+  std::atomic<size_t> tables = 0;
+  std::atomic<size_t> uncached = 0;
+  std::atomic<size_t> budget = roots_cache::DEFAULT_BUDGET;
+  slots<float> floats{};
+  slots<double> doubles{};
+
+  template <typename T>
+  slots<T>& of() {
+    if constexpr (std::same_as<T, float>) {
+      return floats;
+    } else {
+      return doubles;
+    }
+  }
+};
+
+constinit registry cache;
+
+/* the first slot of the probe sequence of n */
+size_t home(size_t n) {
+  constexpr auto bits = std::bit_width(roots_cache::SLOTS - 1);
+  return static_cast<size_t>((std::uint64_t{n} * 0x9e3779b97f4a7c15u) >>
+                             (64 - bits));
+}
+
+/* slots fill in probe order and are never emptied, the first empty one
+ * ends the search */
+template <typename T>
+const roots_table<T>* find(size_t n) {
+  auto& s = cache.of<T>();
+  for (size_t i = 0, h = home(n); i < s.size(); i++) {
+    const auto* t = s[(h + i) % s.size()].load(std::memory_order_acquire);
+    if (t == nullptr || t->values.size() == n) return t;
+  }
+  return nullptr;
+}
+
+/* whether a table of n fits in the room left, a table that does not
+ * fits no later either until the budget is raised */
+template <typename T>
+bool fits(size_t n) {
+  const auto budget = cache.budget.load(std::memory_order_relaxed);
+  const auto bytes = cache.bytes.load(std::memory_order_relaxed);
+  return bytes <= budget && n <= (budget - bytes) / sizeof(complex_base<T>);
+}
+
+/* the cached table of n, built when there is room, or nullptr */
+template <typename T>
+const roots_table<T>* insert(size_t n) {
+  std::lock_guard lock(cache.m);
+  auto& s = cache.of<T>();
+  for (size_t i = 0, h = home(n); i < s.size(); i++) {
+    auto& slot = s[(h + i) % s.size()];
+    const auto* t = slot.load(std::memory_order_relaxed);
+    if (t != nullptr && t->values.size() == n) return t;
+    if (t != nullptr) continue;
+
+    if (!fits<T>(n)) break;
+    t = new roots_table<T>(n);
+    cache.bytes.fetch_add(n * sizeof(complex_base<T>),
+                          std::memory_order_relaxed);
+    cache.tables.fetch_add(1, std::memory_order_relaxed);
+    slot.store(t, std::memory_order_release);
+    return t;
+  }
+  return nullptr;
+}
+
+}  // namespace
+
+namespace detail {
+
+/* exp(-2 pi i k / n). With 4 k = q n + r the angle is q quarter turns plus
+ * (pi / 2) r / n, |r| <= n / 2, whose sin and cos are computed in
+ * double_double */
+template <transform_scalar T>
+complex_base<T> root(size_t k, size_t n) {
+  auto q = 4 * k / n;
+  auto r = static_cast<double>(4 * k % n);
+  if (2 * r > static_cast<double>(n)) {
+    q++;
+    r -= static_cast<double>(n);
+  }
+  const auto sc =
+      gsl::math::sincos(HALF_PI * (double_double{r} / static_cast<double>(n)));
+  const auto c = narrow<T>(sc.cos);
+  const auto s = narrow<T>(sc.sin);
+  switch (q % 4) {
+    case 0:
+      return {c, -s};
+    case 1:
+      return {-s, -c};
+    case 2:
+      return {-c, s};
+    default:
+      return {s, c};
+  }
+}
+
+template complex_base<float> root<float>(size_t, size_t);
+template complex_base<double> root<double>(size_t, size_t);
+
+}  // namespace detail
+
+template <transform_scalar T>
+roots_table<T>::roots_table(size_t n) : values(n) {
+  for (size_t k = 0; k < n; k++) values[k] = detail::root<T>(k, n);
+}
+
+template <transform_scalar T>
+roots<T>::roots(size_type n) {
+  if (n == 0) throw std::invalid_argument("gsl::fft::roots: length 0");
+  auto* t = find<T>(n);
+  if (t == nullptr && fits<T>(n)) t = insert<T>(n);
+  if (t == nullptr) {
+    cache.uncached.fetch_add(1, std::memory_order_relaxed);
+    owned = std::make_unique<const roots_table<T>>(n);
+    t = owned.get();
+  }
+  entries = t->values;
+}
+
+template <transform_scalar T>
+roots<T>::roots(roots&&) noexcept = default;
+template <transform_scalar T>
+roots<T>& roots<T>::operator=(roots&&) noexcept = default;
+template <transform_scalar T>
+roots<T>::~roots() = default;
+
+template class roots<float>;
+template class roots<double>;
+
+roots_cache::usage roots_cache::stats() {
+  std::lock_guard lock(cache.m);
+  return {cache.bytes.load(), cache.tables.load(), cache.uncached.load(),
+          cache.budget.load()};
+}
+
+std::size_t roots_cache::budget() { return cache.budget.load(); }
+
+void roots_cache::set_budget(std::size_t bytes) {
+  std::lock_guard lock(cache.m);
+  cache.budget.store(bytes);
+}
+
+}  // namespace gsl::fft
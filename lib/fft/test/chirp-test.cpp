@@ -0,0 +1,127 @@
+#include <gsl/fft/chirp.h>
+#include <gsl/fft/plan.h>
+#include <gsl/fft/roots.h>
+#include <gsl/type/complex.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+#include "reference.h"
+
+using gsl::fft::chirp_plan;
+using gsl::fft::direction;
+using gsl::fft::plan;
+using gsl::fft::roots_cache;
+using gsl::type::complex_base;
+using gsl::fft::test::bound;
+using gsl::fft::test::czt;
+using gsl::fft::test::error;
+using gsl::fft::test::inputs;
+
+namespace {
+
+template <typename T>
+void check_dft() {
+  /* primes, lengths with a large prime factor and one plan<T> takes */
+  for (const std::size_t n : {1, 2, 3, 11, 13, 17, 22, 97, 257, 1021, 3000}) {
+    SCOPED_TRACE(n);
+    chirp_plan<T> p(n);
+    EXPECT_GE(p.convolution_size(), 2 * n - 1);
+    EXPECT_TRUE(plan<T>::supports(p.convolution_size()));
+    const auto x = inputs<T>(n);
+    const auto l = p.convolution_size();
+
+    std::vector<complex_base<T>> y(n);
+    p.forward(x, y);
+    EXPECT_LE(error(y, czt(x, n, n, 0, -1)), bound<T>(l, 8));
+    p.backward(x, y);
+    EXPECT_LE(error(y, czt(x, n, n, 0, 1)), bound<T>(l, 8));
+
+    auto z = x;
+    p.forward(z);
+    p.inverse(z);
+    EXPECT_LE(error(z, x), bound<T>(l, 16));
+  }
+}
+
+}  // namespace
+
+TEST(FftChirpTest, Double) { check_dft<double>(); }
+
+TEST(FftChirpTest, Float) { check_dft<float>(); }
+
+TEST(FftChirpTest, Zoom) {
+  /* 50 frequencies 10 times finer than the DFT bins, from bin 12.3 on */
+  const std::size_t n = 100;
+  const auto x = inputs<double>(n);
+  chirp_plan<double> p(n, 50, 1000, 123);
+  EXPECT_EQ(p.outputs(), 50u);
+  std::vector<complex_base<double>> y(50);
+  p.forward(x, y);
+  EXPECT_LE(error(y, czt(x, 50, 1000, 123, -1)),
+            bound<double>(p.convolution_size(), 8));
+  p.backward(x, y);
+  EXPECT_LE(error(y, czt(x, 50, 1000, 123, 1)),
+            bound<double>(p.convolution_size(), 8));
+
+  /* a band of the transform of the points zero padded to the bins */
+  const std::size_t bins = 640;
+  std::vector<complex_base<double>> padded(bins);
+  std::copy(x.begin(), x.begin() + 64, padded.begin());
+  plan<double>(bins).forward(padded);
+  chirp_plan<double> band(64, 40, bins, 600);
+  std::vector<complex_base<double>> part(40);
+  band.forward(std::span{x}.first(64), part);
+  EXPECT_LE(error(part, std::vector(padded.begin() + 600, padded.end())),
+            bound<double>(band.convolution_size(), 8));
+
+  /* first wraps around the bins */
+  chirp_plan<double> wrapped(64, 40, bins, 600 + 2 * bins);
+  std::vector<complex_base<double>> same(40);
+  wrapped.forward(std::span{x}.first(64), same);
+  EXPECT_EQ(same, part);
+}
+
+TEST(FftChirpTest, ZoomOfManyBins) {
+  /* 64 of 2^30 bins: the plan computes its few factors one at a time and
+   * neither caches nor builds the table of 2^31 roots */
+  const std::size_t n = 256;
+  const std::size_t m = 64;
+  const std::size_t bins = std::size_t{1} << 30;
+  const auto x = inputs<double>(n);
+  const auto before = roots_cache::stats();
+  chirp_plan<double> p(n, m, bins, 987654321);
+  const auto after = roots_cache::stats();
+  EXPECT_EQ(after.uncached, before.uncached);
+  EXPECT_LE(after.bytes - before.bytes,
+            p.convolution_size() * sizeof(complex_base<double>));
+
+  std::vector<complex_base<double>> y(m);
+  p.forward(x, y);
+  EXPECT_LE(error(y, czt(x, m, bins, 987654321, -1)),
+            bound<double>(p.convolution_size(), 8));
+}
+
+TEST(FftChirpTest, Execute) {
+  const std::size_t n = 37;
+  const chirp_plan<double> p(n);
+  const auto x = inputs<double>(n);
+  std::vector<complex_base<double>> y(n);
+  std::vector<complex_base<double>> scratch(p.scratch_size());
+  p.execute(direction::forward, x, y, scratch);
+  EXPECT_LE(error(y, czt(x, n, n, 0, -1)),
+            bound<double>(p.convolution_size(), 8));
+
+  std::vector<complex_base<double>> small(n - 1);
+  EXPECT_THROW(p.execute(direction::forward, x, y, small),
+               std::invalid_argument);
+  EXPECT_THROW(p.execute(direction::forward, x, small, scratch),
+               std::invalid_argument);
+  EXPECT_THROW(chirp_plan<double>{0}, std::invalid_argument);
+  EXPECT_THROW((chirp_plan<double>{4, 4, 0, 0}), std::invalid_argument);
+  EXPECT_EQ(plan<double>::next_size(1021), 1024u);
+  EXPECT_EQ(plan<double>::next_size(1024), 1024u);
+  EXPECT_EQ(plan<double>::next_size(0), 1u);
+}
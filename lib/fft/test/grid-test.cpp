@@ -0,0 +1,130 @@
+#include <gsl/fft/grid.h>
+#include <gsl/fft/plan.h>
+#include <gsl/type/complex.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "reference.h"
+
+using gsl::fft::grid_plan;
+using gsl::fft::plan;
+using gsl::type::complex_base;
+using gsl::fft::test::bound;
+using gsl::fft::test::error;
+using gsl::fft::test::inputs;
+
+namespace {
+
+/* the 1D forward transform along every axis, from the last one, one line
+ * at a time through a copy */
+template <typename T>
+std::vector<complex_base<T>> reference(const std::vector<std::size_t>& shape,
+                                       std::vector<complex_base<T>> x) {
+  std::size_t stride = 1;
+  for (auto a = shape.size(); a-- > 0;) {
+    const auto length = shape[a];
+    plan<T> p(length);
+    std::vector<complex_base<T>> line(length);
+    for (std::size_t o = 0; o < x.size() / (length * stride); o++) {
+      for (std::size_t c = 0; c < stride; c++) {
+        auto* base = x.data() + o * length * stride + c;
+        for (std::size_t j = 0; j < length; j++) line[j] = base[j * stride];
+        p.forward(line);
+        for (std::size_t j = 0; j < length; j++) base[j * stride] = line[j];
+      }
+    }
+    stride *= length;
+  }
+  return x;
+}
+
+template <typename T>
+void check_shape(const std::vector<std::size_t>& shape) {
+  grid_plan<T> g(shape, 1);
+  const auto x = inputs<T>(g.size());
+  const auto expect = reference(shape, x);
+
+  std::vector<complex_base<T>> y(g.size());
+  g.forward(x, y);
+  EXPECT_EQ(y, expect);
+
+  /* same bits with any number of threads, in place too */
+  grid_plan<T> threaded(shape, 3);
+  EXPECT_EQ(threaded.threads(), 3u);
+  auto z = x;
+  threaded.forward(z);
+  EXPECT_EQ(z, expect);
+
+  threaded.inverse(z);
+  EXPECT_LE(error(z, x), bound<T>(g.size(), 4));
+}
+
+}  // namespace
+
+TEST(FftGridTest, Shapes) {
+  for (const auto& shape : std::vector<std::vector<std::size_t>>{
+           {64}, {6, 10}, {1, 8}, {8, 1}, {32, 48}, {128, 7}, {4, 5, 7},
+           {16, 16, 16}, {3, 60, 2}, {2, 3, 4, 5},
+           /* axes too long for a cache line of columns per tile */
+           {4096, 6}, {16384, 3}}) {
+    SCOPED_TRACE(shape.size());
+    check_shape<double>(shape);
+    check_shape<float>(shape);
+  }
+}
+
+TEST(FftGridTest, Impulse) {
+  /* a shifted impulse is a plane wave */
+  const std::size_t rows = 12;
+  const std::size_t columns = 20;
+  grid_plan<double> g({rows, columns}, 2);
+  std::vector<complex_base<double>> x(g.size());
+  x[3 * columns + 5] = 1;
+  g.forward(x);
+  const auto pi = 3.14159265358979323846;
+  for (std::size_t k = 0; k < rows; k++) {
+    for (std::size_t l = 0; l < columns; l++) {
+      const auto t = -2 * pi * (3.0 * k / rows + 5.0 * l / columns);
+      const auto& z = x[k * columns + l];
+      EXPECT_NEAR(z.real(), std::cos(t), 1e-14);
+      EXPECT_NEAR(z.img(), std::sin(t), 1e-14);
+    }
+  }
+}
+
+TEST(FftGridTest, Timings) {
+  grid_plan<float> g({8, 16, 32}, 2);
+  EXPECT_EQ(g.rank(), 3u);
+  EXPECT_TRUE(g.timings().empty());
+  auto x = inputs<float>(g.size());
+  g.forward(x);
+  const auto t = g.timings();
+  ASSERT_EQ(t.size(), 3u);
+  for (std::size_t s = 0; s < 3; s++) {
+    EXPECT_EQ(t[s].axis, 2 - s);
+    EXPECT_GT(t[s].wall.count(), 0);
+    EXPECT_GT(t[s].transform.count(), 0);
+  }
+  EXPECT_EQ(t[0].copy.count(), 0);
+  EXPECT_GT(t[1].copy.count(), 0);
+}
+
+TEST(FftGridTest, Errors) {
+  EXPECT_THROW(grid_plan<double>({8, 11}), std::invalid_argument);
+  EXPECT_THROW(grid_plan<double>({}), std::invalid_argument);
+  grid_plan<double> g({4, 4}, 1);
+  std::vector<complex_base<double>> x(15);
+  EXPECT_THROW(g.forward(x), std::invalid_argument);
+
+  /* a moved-from plan has no threads and refuses to run */
+  auto moved = std::move(g);
+  EXPECT_EQ(moved.threads(), 1u);
+  EXPECT_EQ(g.threads(), 0u);
+  x.resize(16);
+  EXPECT_THROW(g.forward(x), std::invalid_argument);
+  moved.forward(x);
+}
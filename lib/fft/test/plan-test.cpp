@@ -0,0 +1,109 @@
+#include <gsl/fft/plan.h>
+#include <gsl/type/complex.h>
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "reference.h"
+
+using gsl::fft::direction;
+using gsl::fft::plan;
+using gsl::type::complex_base;
+using gsl::fft::test::bound;
+using gsl::fft::test::dft;
+using gsl::fft::test::error;
+using gsl::fft::test::inputs;
+
+namespace {
+
+/* single radixes, their powers and mixed lengths */
+constexpr std::size_t SIZES[] = {1,   2,   3,   4,   5,    6,    7,   8,  9,
+                                 12,  16,  25,  49,  60,   64,   105, 128, 210,
+                                 343, 375, 512, 1000, 1024, 2401};
+
+template <typename T>
+void check_transforms() {
+  for (const auto n : SIZES) {
+    SCOPED_TRACE(n);
+    plan<T> p(n);
+    const auto x = inputs<T>(n);
+
+    auto copy = x;
+    std::vector<complex_base<T>> y(n);
+    p.forward(x, y);
+    EXPECT_EQ(copy, x);
+    EXPECT_LE(error(y, dft(x, -1)), bound<T>(n, 2));
+
+    p.forward(copy);
+    EXPECT_EQ(copy, y);
+
+    p.backward(x, y);
+    EXPECT_LE(error(y, dft(x, 1)), bound<T>(n, 2));
+    copy = x;
+    p.backward(copy);
+    EXPECT_EQ(copy, y);
+
+    p.forward(x, y);
+    p.inverse(y);
+    EXPECT_LE(error(y, x), bound<T>(n, 4));
+  }
+}
+
+}  // namespace
+
+TEST(FftPlanTest, Double) { check_transforms<double>(); }
+
+TEST(FftPlanTest, Float) { check_transforms<float>(); }
+
+TEST(FftPlanTest, Factors) {
+  for (const auto n : SIZES) {
+    const plan<double> p(n);
+    const auto f = p.factors();
+    EXPECT_EQ(std::accumulate(f.begin(), f.end(), std::size_t{1},
+                              std::multiplies<>{}),
+              n);
+  }
+  EXPECT_EQ(plan<float>(64).factors().size(), 3u);
+  EXPECT_EQ(plan<float>(1).factors().size(), 0u);
+
+  for (const std::size_t n : {0, 11, 22, 13 * 8, 1021}) {
+    EXPECT_FALSE(plan<double>::supports(n));
+    EXPECT_THROW(plan<double>{n}, std::invalid_argument);
+  }
+  EXPECT_TRUE(plan<double>::supports(2 * 3 * 4 * 5 * 7));
+}
+
+TEST(FftPlanTest, Impulse) {
+  /* a shifted impulse is a pure tone, exact at the quarter turns */
+  const std::size_t n = 8;
+  plan<double> p(n);
+  std::vector<complex_base<double>> x(n);
+  x[2] = 1;
+  p.forward(x);
+  const complex_base<double> expect[] = {1, {0, -1}, -1, {0, 1},
+                                         1, {0, -1}, -1, {0, 1}};
+  for (std::size_t k = 0; k < n; k++) EXPECT_EQ(x[k], expect[k]);
+}
+
+TEST(FftPlanTest, Execute) {
+  /* a const plan with the scratch buffer of the caller */
+  const std::size_t n = 60;
+  const plan<double> p(n);
+  const auto x = inputs<double>(n);
+  std::vector<complex_base<double>> y(n);
+  std::vector<complex_base<double>> scratch(p.scratch_size());
+  p.execute(direction::forward, x, y, scratch);
+  EXPECT_LE(error(y, dft(x, -1)), bound<double>(n, 2));
+
+  std::vector<complex_base<double>> z(n);
+  p.execute(direction::inverse, y, z, scratch);
+  EXPECT_LE(error(z, x), bound<double>(n, 4));
+
+  std::vector<complex_base<double>> small(n - 1);
+  EXPECT_THROW(p.execute(direction::forward, x, small, scratch),
+               std::invalid_argument);
+  EXPECT_THROW(p.execute(direction::forward, x, y, small),
+               std::invalid_argument);
+}
@@ -0,0 +1,117 @@
+#include <gsl/fft/plan.h>
+#include <gsl/fft/real.h>
+#include <gsl/type/complex.h>
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <vector>
+
+#include "reference.h"
+
+using gsl::fft::direction;
+using gsl::fft::plan;
+using gsl::fft::real_plan;
+using gsl::type::complex_base;
+using gsl::fft::test::bound;
+using gsl::fft::test::error;
+using gsl::fft::test::real_inputs;
+
+namespace {
+
+/* even lengths take the half length trick, odd ones the full plan */
+constexpr std::size_t SIZES[] = {1,  2,  3,  4,   5,   6,   7,   8,    10,
+                                 12, 14, 15, 16,  30,  49,  60,  64,   98,
+                                 105, 128, 210, 375, 512, 1000, 1024, 2401};
+
+/* the first n / 2 + 1 points of the complex transform of x, in double */
+template <typename T>
+std::vector<complex_base<double>> reference(const std::vector<T>& x) {
+  const auto n = x.size();
+  std::vector<complex_base<double>> z(x.begin(), x.end());
+  plan<double>(n).forward(z);
+  z.resize(n / 2 + 1);
+  return z;
+}
+
+template <typename T>
+void check_transforms() {
+  for (const auto n : SIZES) {
+    SCOPED_TRACE(n);
+    real_plan<T> p(n);
+    ASSERT_EQ(p.spectrum_size(), n / 2 + 1);
+    const auto x = real_inputs<T>(n);
+    const auto ref = reference(x);
+
+    std::vector<complex_base<T>> y(p.spectrum_size());
+    p.forward(x, y);
+    EXPECT_LE(error(y, ref), bound<T>(n, 4));
+    EXPECT_EQ(y[0].img(), 0);
+    if (n % 2 == 0) {
+      EXPECT_EQ(y[n / 2].img(), 0);
+    }
+
+    std::vector<T> back(n);
+    p.backward(y, back);
+    for (auto& v : back) v /= static_cast<T>(n);
+    EXPECT_LE(error(back, x), bound<T>(n, 8));
+    p.inverse(y, back);
+    EXPECT_LE(error(back, x), bound<T>(n, 8));
+
+    /* the halfcomplex layout of the same spectrum */
+    auto packed = x;
+    p.forward_halfcomplex(packed);
+    std::vector<T> expect(n);
+    gsl::fft::pack_halfcomplex<T>(y, expect);
+    EXPECT_EQ(packed, expect);
+    p.inverse_halfcomplex(packed);
+    EXPECT_LE(error(packed, x), bound<T>(n, 8));
+  }
+}
+
+}  // namespace
+
+TEST(FftRealTest, Double) { check_transforms<double>(); }
+
+TEST(FftRealTest, Float) { check_transforms<float>(); }
+
+TEST(FftRealTest, Halfcomplex) {
+  const std::vector<complex_base<double>> even = {1, {2, 3}, {4, 5}, 6};
+  std::vector<double> packed(6);
+  gsl::fft::pack_halfcomplex<double>(even, packed);
+  EXPECT_EQ(packed, (std::vector<double>{1, 2, 3, 4, 5, 6}));
+  std::vector<complex_base<double>> spectrum(4);
+  gsl::fft::unpack_halfcomplex<double>(packed, spectrum);
+  EXPECT_EQ(spectrum, even);
+
+  const std::vector<complex_base<double>> odd = {1, {2, 3}, {4, 5}};
+  packed.resize(5);
+  gsl::fft::pack_halfcomplex<double>(odd, packed);
+  EXPECT_EQ(packed, (std::vector<double>{1, 2, 3, 4, 5}));
+  spectrum.resize(3);
+  gsl::fft::unpack_halfcomplex<double>(packed, spectrum);
+  EXPECT_EQ(spectrum, odd);
+
+  EXPECT_THROW(gsl::fft::pack_halfcomplex<double>(even, packed),
+               std::invalid_argument);
+}
+
+TEST(FftRealTest, Execute) {
+  const std::size_t n = 210;
+  const real_plan<double> p(n);
+  const auto x = real_inputs<double>(n);
+  std::vector<complex_base<double>> y(p.spectrum_size());
+  std::vector<complex_base<double>> scratch(p.scratch_size());
+  p.execute(x, y, scratch);
+  EXPECT_LE(error(y, reference(x)), bound<double>(n, 4));
+
+  std::vector<double> back(n);
+  p.execute(direction::inverse, y, back, scratch);
+  EXPECT_LE(error(back, x), bound<double>(n, 8));
+
+  EXPECT_THROW(p.execute(direction::forward, y, back, scratch),
+               std::invalid_argument);
+  EXPECT_THROW(p.execute(x, std::span{y}.first(n / 2), scratch),
+               std::invalid_argument);
+  EXPECT_THROW(real_plan<double>{22}, std::invalid_argument);
+  EXPECT_THROW(real_plan<double>{0}, std::invalid_argument);
+}
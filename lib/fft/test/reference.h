@@ -0,0 +1,103 @@
+#pragma once
+
+#include <gsl/type/complex.h>
+
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <vector>
+
+/* The inputs, references and error measures the FFT tests share */
+
+namespace gsl::fft::test {
+
+using gsl::type::complex_base;
+
+/* n points uniform in [-1, 1], the same ones for the same n */
+template <typename T>
+std::vector<complex_base<T>> inputs(std::size_t n) {
+  std::mt19937 gen(static_cast<unsigned>(n));
+  std::uniform_real_distribution<T> u(-1, 1);
+  std::vector<complex_base<T>> r(n);
+  for (auto& z : r) z = {u(gen), u(gen)};
+  return r;
+}
+
+template <typename T>
+std::vector<T> real_inputs(std::size_t n) {
+  std::mt19937 gen(static_cast<unsigned>(n));
+  std::uniform_real_distribution<T> u(-1, 1);
+  std::vector<T> r(n);
+  for (auto& x : r) x = u(gen);
+  return r;
+}
+
+/* y[j] = sum_t x[t] exp(sign 2 pi i t (first + j) / bins), straight from
+ * the definition in long double, through a table of the bins roots unless
+ * there are more of them than terms */
+template <typename T>
+std::vector<complex_base<long double>> czt(
+    const std::vector<complex_base<T>>& x, std::size_t m, std::size_t bins,
+    std::size_t first, int sign) {
+  const auto root = [&](std::size_t k) {
+    const auto t = 2 * 3.14159265358979323846264338327950288L * k / bins;
+    return complex_base<long double>{std::cos(t), sign * std::sin(t)};
+  };
+  std::vector<complex_base<long double>> w;
+  if (bins <= x.size() * m) {
+    w.resize(bins);
+    for (std::size_t k = 0; k < bins; k++) w[k] = root(k);
+  }
+  std::vector<complex_base<long double>> y(m);
+  for (std::size_t j = 0; j < m; j++) {
+    for (std::size_t t = 0; t < x.size(); t++) {
+      const auto k = t * (first + j) % bins;
+      y[j] = y[j] + complex_base<long double>(x[t]) *
+                        (w.empty() ? root(k) : w[k]);
+    }
+  }
+  return y;
+}
+
+/* the n point transform of x, sign -1 forward and +1 backward */
+template <typename T>
+std::vector<complex_base<long double>> dft(
+    const std::vector<complex_base<T>>& x, int sign) {
+  return czt(x, x.size(), x.size(), 0, sign);
+}
+
+/* the relative l2 errors of complex and real results */
+template <typename T, typename U>
+double error(const std::vector<complex_base<T>>& y,
+             const std::vector<complex_base<U>>& ref) {
+  long double e = 0;
+  long double r = 0;
+  for (std::size_t i = 0; i < y.size(); i++) {
+    e += (complex_base<long double>(y[i]) - complex_base<long double>(ref[i]))
+             .norm();
+    r += complex_base<long double>(ref[i]).norm();
+  }
+  return r == 0 ? 0 : static_cast<double>(std::sqrt(e / r));
+}
+
+template <std::floating_point T, std::floating_point U>
+double error(const std::vector<T>& y, const std::vector<U>& ref) {
+  long double e = 0;
+  long double r = 0;
+  for (std::size_t i = 0; i < y.size(); i++) {
+    const auto d = static_cast<long double>(y[i]) - ref[i];
+    e += d * d;
+    r += static_cast<long double>(ref[i]) * ref[i];
+  }
+  return r == 0 ? 0 : static_cast<double>(std::sqrt(e / r));
+}
+
+/* c epsilons of T per radix stage of a length n transform */
+template <typename T>
+double bound(std::size_t n, double c) {
+  return c * std::numeric_limits<T>::epsilon() * (std::log2(n) + 1);
+}
+
+}  // namespace gsl::fft::test
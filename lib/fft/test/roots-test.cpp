@@ -0,0 +1,157 @@
+#include <gsl/fft/plan.h>
+#include <gsl/fft/real.h>
+#include <gsl/fft/roots.h>
+#include <gsl/type/complex.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using gsl::fft::plan;
+using gsl::fft::real_plan;
+using gsl::fft::roots;
+using gsl::fft::roots_cache;
+
+namespace {
+
+/* |x - ref| in units of the last place of x; a zero is an exact quarter
+ * turn, its reference is the rounding error of the angle */
+template <typename T>
+long double ulps(T x, long double ref) {
+  if (x == 0) return std::fabs(ref) < 1e-16L ? 0 : 1;
+  const auto up = std::nextafter(x, std::numeric_limits<T>::infinity());
+  return std::fabs(x - ref) / (static_cast<long double>(up) - x);
+}
+
+/* cos and -sin of 2 pi k / n in long double, from an angle of at most
+ * pi / 4 and quarter turns, which keeps the reference within 2^-60 of them */
+std::pair<long double, long double> reference(std::size_t k, std::size_t n) {
+  const auto q = (8 * k + n) / (2 * n);
+  const auto a = 1.57079632679489661923132169163975144L *
+                 (4 * static_cast<long double>(k) -
+                  static_cast<long double>(q * n)) /
+                 n;
+  const auto c = std::cos(a);
+  const auto s = std::sin(a);
+  switch (q % 4) {
+    case 0:
+      return {c, -s};
+    case 1:
+      return {-s, -c};
+    case 2:
+      return {-c, s};
+    default:
+      return {s, c};
+  }
+}
+
+template <typename T>
+void check_accuracy() {
+  for (const std::size_t n : {1, 2, 3, 4, 5, 7, 12, 60, 97, 1000, 1024, 4099}) {
+    SCOPED_TRACE(n);
+    const roots<T> w(n);
+    ASSERT_EQ(w.size(), n);
+    for (std::size_t k = 0; k < n; k++) {
+      const auto [c, s] = reference(k, n);
+      /* correctly rounded up to the error of the reference */
+      EXPECT_LE(ulps(w[k].real(), c), 0.501L) << k;
+      EXPECT_LE(ulps(w[k].img(), s), 0.501L) << k;
+      /* the entries computed on their own are the same */
+      EXPECT_EQ(gsl::fft::detail::root<T>(k, n), w[k]) << k;
+    }
+    /* quarter and half turns are exact */
+    EXPECT_EQ(w[0].real(), T(1));
+    EXPECT_EQ(w[0].img(), T(0));
+    if (n % 2 == 0) {
+      EXPECT_EQ(w[n / 2].real(), T(-1));
+      EXPECT_EQ(w[n / 2].img(), T(0));
+    }
+    if (n % 4 == 0) {
+      EXPECT_EQ(w[n / 4].real(), T(0));
+      EXPECT_EQ(w[n / 4].img(), T(-1));
+      EXPECT_EQ(w[3 * n / 4].real(), T(0));
+      EXPECT_EQ(w[3 * n / 4].img(), T(1));
+    }
+  }
+}
+
+}  // namespace
+
+TEST(FftRootsTest, Double) { check_accuracy<double>(); }
+
+TEST(FftRootsTest, Float) { check_accuracy<float>(); }
+
+TEST(FftRootsTest, Shared) {
+  const roots<double> a(360);
+  const roots<double> b(360);
+  EXPECT_TRUE(a.cached());
+  EXPECT_EQ(a.values().data(), b.values().data());
+
+  /* one table per precision */
+  const roots<float> f(360);
+  EXPECT_NE(static_cast<const void*>(f.values().data()),
+            static_cast<const void*>(a.values().data()));
+
+  /* the plans built in other threads find the same table */
+  std::vector<const void*> seen(4);
+  std::vector<std::thread> threads;
+  for (std::size_t i = 0; i < seen.size(); i++) {
+    threads.emplace_back([&seen, i] {
+      plan<double> p(840);
+      real_plan<double> r(840);
+      seen[i] = roots<double>(840).values().data();
+    });
+  }
+  for (auto& t : threads) t.join();
+  for (const auto* s : seen) EXPECT_EQ(s, seen[0]);
+
+  /* a moved handle keeps the table */
+  auto c = roots<double>(360);
+  const auto moved = std::move(c);
+  EXPECT_EQ(moved.values().data(), a.values().data());
+}
+
+TEST(FftRootsTest, Budget) {
+  const auto before = roots_cache::stats();
+  EXPECT_EQ(before.budget, roots_cache::DEFAULT_BUDGET);
+  EXPECT_LE(before.bytes, before.budget);
+
+  const roots<double> a(4321);
+  auto after = roots_cache::stats();
+  EXPECT_EQ(after.tables, before.tables + 1);
+  EXPECT_EQ(after.bytes,
+            before.bytes + 4321 * sizeof(roots<double>::value_type));
+
+  /* no room: the handle owns its table, the cached ones stay */
+  roots_cache::set_budget(0);
+  const roots<double> b(4322);
+  EXPECT_FALSE(b.cached());
+  EXPECT_EQ(b.size(), 4322u);
+  EXPECT_EQ(roots<double>(4321).values().data(), a.values().data());
+  const auto full = roots_cache::stats();
+  EXPECT_EQ(full.tables, after.tables);
+  EXPECT_EQ(full.uncached, after.uncached + 1);
+  EXPECT_EQ(full.budget, 0u);
+
+  /* the tables with no room are built outside the cache in every thread */
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; i++) {
+    threads.emplace_back([] { EXPECT_FALSE(roots<float>(4323).cached()); });
+  }
+  for (auto& t : threads) t.join();
+  EXPECT_EQ(roots_cache::stats().uncached, full.uncached + 4);
+  EXPECT_EQ(roots_cache::stats().tables, full.tables);
+
+  /* an owned table is as accurate as a cached one */
+  roots_cache::set_budget(roots_cache::DEFAULT_BUDGET);
+  const roots<double> c(4322);
+  EXPECT_TRUE(c.cached());
+  for (std::size_t k = 0; k < c.size(); k++) EXPECT_EQ(b[k], c[k]);
+
+  EXPECT_THROW(roots<double>{0}, std::invalid_argument);
+}
@@ -0,0 +1,443 @@
+#include <benchmark/benchmark.h>
+#include <gsl/math/complex.h>
+#include <gsl/math/complex_batch.h>
+#include <gsl/type/complex.h>
+
+#include <array>
+#include <cmath>
+#include <compare>
+#include <cstddef>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/* Latency and throughput of the complex functions
+ *
+ * Every implemented function of gsl/math/complex.h and every operator of
+ * complex_base is registered for float, double, long double and
+ * double_double and for each input regime, under the name
+ *
+ *   <mode>/<function>/<type>/<regime>
+ *
+ * latency     one call after the other, the argument of a call is picked
+ *             with an index that depends on the previous result, so the
+ *             time includes an L1 load on top of the function
+ * throughput  independent calls over all the inputs of the regime
+ * batch       the span overload of gsl/math/complex_batch.h over the same
+ *             inputs, functions only
+ *
+ * The 16 bit storage types float16 and bfloat16 have no scalar functions,
+ * only their batch overloads are registered.
+ *
+ * Filter with --benchmark_filter, e.g. '^latency/sqrt/double/'. */
+
+namespace {
+
+using gsl::type::complex_base;
+
+/* inputs per regime, a power of two */
+constexpr std::size_t N = 1024;
+
+/* the regimes of complex-data/results.h */
+enum class regime {
+  tiny,       /* both parts around the float epsilon */
+  huge,       /* at least one part around 2^23 */
+  branch_cut, /* next to the cuts of log, sqrt, pow and the inverse
+                 functions */
+  axes        /* on the real or imaginary axis */
+};
+
+constexpr std::array regimes{regime::tiny, regime::huge, regime::branch_cut,
+                             regime::axes};
+
+constexpr std::string_view name(regime g) {
+  switch (g) {
+    case regime::tiny:
+      return "tiny";
+    case regime::huge:
+      return "huge";
+    case regime::branch_cut:
+      return "branch_cut";
+    default:
+      return "axes";
+  }
+}
+
+template <typename T>
+std::vector<complex_base<T>> points(regime g) {
+  const T tiny = 1.19209289550781250e-07, huge = 8.3886080e+06;
+  const T mid[] = {5.0e-01, 1, 2, 3.14};
+  std::vector<complex_base<T>> r;
+
+  const auto signs = [&r](T x, T y) {
+    r.emplace_back(x, y);
+    r.emplace_back(-x, y);
+    r.emplace_back(x, -y);
+    r.emplace_back(-x, -y);
+  };
+
+  switch (g) {
+    case regime::tiny:
+      signs(tiny, tiny);
+      signs(tiny, 0);
+      signs(0, tiny);
+      break;
+    case regime::huge:
+      signs(huge, huge);
+      for (const auto m : mid) {
+        signs(huge, m);
+        signs(m, huge);
+      }
+      break;
+    case regime::branch_cut:
+      /* the negative real axis, the real axis past +-1 and the imaginary
+       * axis past +-i, approached from both sides */
+      for (const auto m : mid) {
+        r.emplace_back(-m, tiny);
+        r.emplace_back(-m, -tiny);
+      }
+      r.emplace_back(-huge, tiny);
+      r.emplace_back(-huge, -tiny);
+      signs(2, tiny);
+      signs(3.14, tiny);
+      signs(tiny, 2);
+      signs(tiny, 3.14);
+      break;
+    case regime::axes:
+      r.emplace_back(0, 0);
+      for (const auto m : mid) {
+        signs(m, 0);
+        signs(0, m);
+      }
+      break;
+  }
+  return r;
+}
+
+template <typename T>
+struct data {
+  std::vector<complex_base<T>> z;
+  std::vector<complex_base<T>> w; /* second operand */
+  std::vector<T> x;               /* real operand, the real parts of z */
+  T s = 1.5;                      /* real scalar operand */
+};
+
+template <typename T>
+data<T> make_data(regime g) {
+  const auto p = points<T>(g);
+  data<T> d;
+  for (std::size_t i = 0; i < N; i++) {
+    d.z.push_back(p[i % p.size()]);
+    d.w.push_back(p[(p.size() - 1 - i % p.size() + i / p.size()) % p.size()]);
+    d.x.push_back(d.z.back().real());
+  }
+  return d;
+}
+
+template <typename T>
+const data<T> &inputs(regime g) {
+  static const std::array<data<T>, regimes.size()> all{
+      make_data<T>(regime::tiny), make_data<T>(regime::huge),
+      make_data<T>(regime::branch_cut), make_data<T>(regime::axes)};
+  return all[static_cast<std::size_t>(g)];
+}
+
+template <typename T>
+struct output {
+  std::vector<complex_base<T>> z = std::vector<complex_base<T>>(N);
+  std::vector<T> x = std::vector<T>(N);
+};
+
+/* a value that depends on the result without the compiler being able to
+ * fold it */
+template <gsl::math::floating_scalar T>
+std::size_t bits(T r) {
+  return r != r;
+}
+
+template <typename T>
+std::size_t bits(const complex_base<T> &r) {
+  return bits(r.real());
+}
+
+std::size_t bits(bool r) { return r; }
+
+std::size_t bits(std::partial_ordering r) { return r == 0; }
+
+template <typename T, typename Call>
+void latency(benchmark::State &state, regime g, Call call) {
+  const auto &d = inputs<T>(g);
+  std::size_t mask = 0;
+  benchmark::DoNotOptimize(mask);
+
+  std::size_t i = 0;
+  for (auto _ : state) {
+    const auto r = call(d, i);
+    i = (i + 1 + (bits(r) & mask)) & (N - 1);
+  }
+  benchmark::DoNotOptimize(i);
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <typename T, typename Call>
+void throughput(benchmark::State &state, regime g, Call call) {
+  const auto &d = inputs<T>(g);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < N; i++) {
+      auto r = call(d, i);
+      benchmark::DoNotOptimize(r);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * N);
+}
+
+template <typename T, typename Batch>
+void batch(benchmark::State &state, regime g, Batch f) {
+  const auto &d = inputs<T>(g);
+  output<T> o;
+  for (auto _ : state) {
+    f(d, o);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * N);
+}
+
+template <typename T, typename Call>
+void add(std::string_view type, std::string_view fn, Call call) {
+  for (const auto g : regimes) {
+    const auto suffix =
+        std::string(fn) + "/" + std::string(type) + "/" + std::string(name(g));
+    benchmark::RegisterBenchmark(
+        ("latency/" + suffix).c_str(),
+        [g, call](benchmark::State &s) { latency<T>(s, g, call); });
+    benchmark::RegisterBenchmark(
+        ("throughput/" + suffix).c_str(),
+        [g, call](benchmark::State &s) { throughput<T>(s, g, call); });
+  }
+}
+
+template <typename T, typename Batch>
+void add_batch(std::string_view type, std::string_view fn, Batch f) {
+  for (const auto g : regimes) {
+    const auto n = "batch/" + std::string(fn) + "/" + std::string(type) + "/" +
+                   std::string(name(g));
+    benchmark::RegisterBenchmark(
+        n.c_str(), [g, f](benchmark::State &s) { batch<T>(s, g, f); });
+  }
+}
+
+template <typename T, typename Call, typename Batch>
+void add(std::string_view type, std::string_view fn, Call call, Batch f) {
+  add<T>(type, fn, call);
+  add_batch<T>(type, fn, f);
+}
+
+/* Functions of gsl/math/complex.h, by the shape of their span overload.
+ * Those still returning zero (log_b, arcsec, arccsc, arcsech, arccsch,
+ * arccoth and the *_real forms other than sqrt_real) are left out until
+ * they are implemented. */
+
+#define GSL_BENCH_UNARY(X) \
+  X(conjugate)             \
+  X(inverse)               \
+  X(negative)              \
+  X(sqrt)                  \
+  X(exp)                   \
+  X(log)                   \
+  X(log10)                 \
+  X(sin)                   \
+  X(cos)                   \
+  X(sec)                   \
+  X(csc)                   \
+  X(tan)                   \
+  X(cot)                   \
+  X(arcsin)                \
+  X(arccos)                \
+  X(arctan)                \
+  X(arccot)                \
+  X(sinh)                  \
+  X(cosh)                  \
+  X(sech)                  \
+  X(csch)                  \
+  X(tanh)                  \
+  X(coth)                  \
+  X(arcsinh)               \
+  X(arccosh)               \
+  X(arctanh)
+
+#define GSL_BENCH_TO_REAL(X) \
+  X(arg)                     \
+  X(abs)                     \
+  X(abs2)                    \
+  X(logabs)
+
+#define GSL_BENCH_FROM_REAL(X) X(sqrt_real)
+
+#define GSL_BENCH_BINARY(X) \
+  X(add)                    \
+  X(sub)                    \
+  X(mul)                    \
+  X(div)                    \
+  X(pow)
+
+#define GSL_BENCH_WITH_REAL(X) \
+  X(add_real)                  \
+  X(sub_real)                  \
+  X(mul_real)                  \
+  X(div_real)                  \
+  X(add_imag)                  \
+  X(sub_imag)                  \
+  X(mul_imag)                  \
+  X(div_imag)                  \
+  X(pow_real)
+
+/* Operators and members of complex_base */
+
+#define GSL_BENCH_OPERATORS(X)                                    \
+  X(op_add, d.z[i] + d.w[i])                                      \
+  X(op_add_real, d.z[i] + d.s)                                    \
+  X(op_real_add, d.s + d.z[i])                                    \
+  X(op_sub, d.z[i] - d.w[i])                                      \
+  X(op_sub_real, d.z[i] - d.s)                                    \
+  X(op_real_sub, d.s - d.z[i])                                    \
+  X(op_neg, -d.z[i])                                              \
+  X(op_mul, d.z[i] * d.w[i])                                      \
+  X(op_mul_real, d.z[i] * d.s)                                    \
+  X(op_real_mul, d.s * d.z[i])                                    \
+  X(op_div, d.z[i] / d.w[i])                                      \
+  X(op_div_real, d.z[i] / d.s)                                    \
+  X(op_real_div, d.s / d.z[i])                                    \
+  X(op_eq, d.z[i] == d.w[i])                                      \
+  X(op_cmp, d.z[i] <=> d.w[i])                                    \
+  X(op_bool, static_cast<bool>(d.z[i]))                           \
+  X(norm, d.z[i].norm())                                          \
+  X(dist, d.z[i].dist())                                          \
+  X(dist2, dist(d.z[i], d.w[i]))                                  \
+  X(angle_in_rads, d.z[i].angle_in_rads())                        \
+  X(angle_in_rads2, d.z[i].angle_in_rads2())                      \
+  X(congugate, d.z[i].congugate())                                \
+  X(inverse_member, d.z[i].inverse())                             \
+  X(polar, (complex_base<T>{complex_base<T>::polar, d.x[i], d.s}))
+
+template <typename T>
+void register_type(std::string_view type) {
+  using K = complex_base<T>;
+
+#define GSL_BENCH_ADD_UNARY(name)                                     \
+  add<T>(                                                             \
+      type, #name,                                                    \
+      [](const data<T> &d, std::size_t i) {                           \
+        return gsl::math::name<T>(d.z[i]);                            \
+      },                                                              \
+      [](const data<T> &d, output<T> &o) {                            \
+        gsl::math::name<T>(std::span<const K>{d.z}, std::span<K>{o.z}); \
+      });
+#define GSL_BENCH_ADD_TO_REAL(name)                                   \
+  add<T>(                                                             \
+      type, #name,                                                    \
+      [](const data<T> &d, std::size_t i) {                           \
+        return gsl::math::name<T>(d.z[i]);                            \
+      },                                                              \
+      [](const data<T> &d, output<T> &o) {                            \
+        gsl::math::name<T>(std::span<const K>{d.z}, std::span<T>{o.x}); \
+      });
+#define GSL_BENCH_ADD_FROM_REAL(name)                                 \
+  add<T>(                                                             \
+      type, #name,                                                    \
+      [](const data<T> &d, std::size_t i) {                           \
+        return gsl::math::name<T>(d.x[i]);                            \
+      },                                                              \
+      [](const data<T> &d, output<T> &o) {                            \
+        gsl::math::name<T>(std::span<const T>{d.x}, std::span<K>{o.z}); \
+      });
+#define GSL_BENCH_ADD_BINARY(name)                                    \
+  add<T>(                                                             \
+      type, #name,                                                    \
+      [](const data<T> &d, std::size_t i) {                           \
+        return gsl::math::name<T>(d.z[i], d.w[i]);                    \
+      },                                                              \
+      [](const data<T> &d, output<T> &o) {                            \
+        gsl::math::name<T>(std::span<const K>{d.z},                   \
+                           std::span<const K>{d.w}, std::span<K>{o.z}); \
+      });
+#define GSL_BENCH_ADD_WITH_REAL(name)                                 \
+  add<T>(                                                             \
+      type, #name,                                                    \
+      [](const data<T> &d, std::size_t i) {                           \
+        return gsl::math::name<T>(d.z[i], d.s);                       \
+      },                                                              \
+      [](const data<T> &d, output<T> &o) {                            \
+        gsl::math::name<T>(std::span<const K>{d.z}, d.s,              \
+                           std::span<K>{o.z});                        \
+      });
+#define GSL_BENCH_ADD_OPERATOR(name, expr) \
+  add<T>(type, #name,                      \
+         [](const data<T> &d, std::size_t i) { return expr; });
+
+  GSL_BENCH_UNARY(GSL_BENCH_ADD_UNARY)
+  GSL_BENCH_TO_REAL(GSL_BENCH_ADD_TO_REAL)
+  GSL_BENCH_FROM_REAL(GSL_BENCH_ADD_FROM_REAL)
+  GSL_BENCH_BINARY(GSL_BENCH_ADD_BINARY)
+  GSL_BENCH_WITH_REAL(GSL_BENCH_ADD_WITH_REAL)
+  GSL_BENCH_OPERATORS(GSL_BENCH_ADD_OPERATOR)
+
+#undef GSL_BENCH_ADD_UNARY
+#undef GSL_BENCH_ADD_TO_REAL
+#undef GSL_BENCH_ADD_FROM_REAL
+#undef GSL_BENCH_ADD_BINARY
+#undef GSL_BENCH_ADD_WITH_REAL
+#undef GSL_BENCH_ADD_OPERATOR
+}
+
+/* the batch overloads only, for the storage types */
+template <typename T>
+void register_storage(std::string_view type) {
+  using K = complex_base<T>;
+
+#define GSL_BENCH_ADD_UNARY(name)                                       \
+  add_batch<T>(type, #name, [](const data<T> &d, output<T> &o) {        \
+    gsl::math::name<T>(std::span<const K>{d.z}, std::span<K>{o.z});     \
+  });
+#define GSL_BENCH_ADD_TO_REAL(name)                                     \
+  add_batch<T>(type, #name, [](const data<T> &d, output<T> &o) {        \
+    gsl::math::name<T>(std::span<const K>{d.z}, std::span<T>{o.x});     \
+  });
+#define GSL_BENCH_ADD_FROM_REAL(name)                                   \
+  add_batch<T>(type, #name, [](const data<T> &d, output<T> &o) {        \
+    gsl::math::name<T>(std::span<const T>{d.x}, std::span<K>{o.z});     \
+  });
+#define GSL_BENCH_ADD_BINARY(name)                                      \
+  add_batch<T>(type, #name, [](const data<T> &d, output<T> &o) {        \
+    gsl::math::name<T>(std::span<const K>{d.z}, std::span<const K>{d.w}, \
+                       std::span<K>{o.z});                              \
+  });
+#define GSL_BENCH_ADD_WITH_REAL(name)                                   \
+  add_batch<T>(type, #name, [](const data<T> &d, output<T> &o) {        \
+    gsl::math::name<T>(std::span<const K>{d.z}, d.s, std::span<K>{o.z}); \
+  });
+
+  GSL_BENCH_UNARY(GSL_BENCH_ADD_UNARY)
+  GSL_BENCH_TO_REAL(GSL_BENCH_ADD_TO_REAL)
+  GSL_BENCH_FROM_REAL(GSL_BENCH_ADD_FROM_REAL)
+  GSL_BENCH_BINARY(GSL_BENCH_ADD_BINARY)
+  GSL_BENCH_WITH_REAL(GSL_BENCH_ADD_WITH_REAL)
+
+#undef GSL_BENCH_ADD_UNARY
+#undef GSL_BENCH_ADD_TO_REAL
+#undef GSL_BENCH_ADD_FROM_REAL
+#undef GSL_BENCH_ADD_BINARY
+#undef GSL_BENCH_ADD_WITH_REAL
+}
+
+[[maybe_unused]] const bool registered = [] {
+  register_type<float>("float");
+  register_type<double>("double");
+  register_type<long double>("long_double");
+  register_type<gsl::math::double_double>("double_double");
+  register_storage<gsl::math::float16>("float16");
+  register_storage<gsl::math::bfloat16>("bfloat16");
+  return true;
+}();
+
+}  // namespace
@@ -0,0 +1,370 @@
+#pragma once
+
+#include <gsl/math/complex.h>
+#include <gsl/math/instrument.h>
+#include <gsl/math/real.h>
+#include <gsl/math/robust.h>
+#include <gsl/type/complex.h>
+#include <gsl/type/complex_like.h>
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+
+namespace gsl::math {
+
+namespace accuracy {
+/* Accuracy tiers of the complex functions
+ *
+ * fast      the textbook formulas, what the untagged functions of
+ *           gsl/math/complex.h compute. |z|^2 is formed directly, so the
+ *           inputs must be well scaled: sqrt(min) < |z| < sqrt(max).
+ * standard  intermediate results are scaled, there is no spurious overflow
+ *           or underflow over the whole floating point range.
+ * robust    standard, plus the algorithms of Hull, Fairgrieve and Tang (see
+ *           src/complex.cpp) for the inverse functions and Smith's division,
+ *           accurate near the branch points and cuts where the log formulas
+ *           cancel. They are computed in the branch-light stages of
+ *           gsl/math/robust.h, shared with the robust batch kernels.
+ *
+ * max_error bounds |f(z) - exact| / |exact| in units of the epsilon of T
+ * over the domain of the tier for arg, abs, logabs, inverse, div, sqrt, log,
+ * log10 and pow, pow for |b log a| <= 4: past that the rounding of log a
+ * alone costs |b log a| epsilons. test/accuracy-test.cpp checks it against
+ * complex-data/results.h for arg, abs, logabs, sqrt, log and log10 and
+ * against std::complex<long double> for inverse, div and pow. The inverse
+ * trigonometric and hyperbolic functions are only bounded in the robust
+ * tier, the log formulas of the other two cancel near the branch points.
+ * The functions without a tagged overload compute the same thing in every
+ * tier. */
+
+struct fast_t {
+  constexpr static int max_error = 64;
+};
+
+struct standard_t {
+  constexpr static int max_error = 16;
+};
+
+struct robust_t {
+  constexpr static int max_error = 8;
+};
+
+constexpr fast_t fast{};
+constexpr standard_t standard{};
+constexpr robust_t robust{};
+
+template <typename P>
+concept policy = std::same_as<P, fast_t> || std::same_as<P, standard_t> ||
+                 std::same_as<P, robust_t>;
+
+template <floating_scalar T, policy P>
+constexpr T bound(P = {}) {
+  return P::max_error * robust::machine<T>::EPSILON;
+}
+
+}  // namespace accuracy
+
+namespace detail {
+
+template <typename P>
+constexpr bool is_fast = std::same_as<P, accuracy::fast_t>;
+
+template <typename P>
+constexpr bool is_robust = std::same_as<P, accuracy::robust_t>;
+
+/* the tagged overloads count their calls, but in the fast tier when they
+ * forward to the untagged function, which counts itself */
+
+}  // namespace detail
+
+/* Properties of complex numbers */
+
+template <typename T, accuracy::policy P>
+constexpr T arg(const complex_base<T> &z, P) {
+  if constexpr (!detail::is_fast<P>) GSL_MATH_COUNT_CALL(arg);
+  if constexpr (detail::is_fast<P>) {
+    return arg<T>(z);
+  } else {
+    /* |z| underflows before z is 0 */
+    GSL_MATH_COUNT_PATH_IF(arg, special_case, z.real() == 0 && z.img() == 0);
+    if (z.real() == 0 && z.img() == 0) return 0;
+    return real::atan2(z.img(), z.real());
+  }
+} /* return arg(z), -pi< arg(z) <=+pi */
+
+template <typename T, accuracy::policy P>
+constexpr T abs(const complex_base<T> &z, P) {
+  if constexpr (!detail::is_fast<P>) GSL_MATH_COUNT_CALL(abs);
+  if constexpr (detail::is_fast<P>) {
+    return abs<T>(z);
+  } else {
+    return real::hypot(z.real(), z.img());
+  }
+} /* return |z| */
+
+template <typename T, accuracy::policy P>
+constexpr T logabs(const complex_base<T> &z, P) {
+  if constexpr (!detail::is_fast<P>) GSL_MATH_COUNT_CALL(logabs);
+  if constexpr (detail::is_fast<P>) {
+    return logabs<T>(z);
+  } else if constexpr (detail::is_robust<P>) {
+    const auto h = robust::logabs_prep(z.real(), z.img());
+    return real::log(h.m) + real::log1p(h.a) / 2;
+  } else {
+    const T x = real::fabs(z.real());
+    const T y = real::fabs(z.img());
+    const T max = std::max(x, y);
+    const T min = std::min(x, y);
+
+    GSL_MATH_COUNT_PATH_IF(logabs, special_case, max == 0 || real::isinf(max));
+    if (max == 0 || real::isinf(max)) return real::log(max);
+
+    /* min / max may underflow, log1p keeps it */
+    const T u = min / max;
+    return real::log(max) + real::log1p(u * u) / 2;
+  }
+} /* return log|z| */
+
+/* Complex arithmetic operators */
+
+template <typename T, accuracy::policy P>
+constexpr auto inverse(const complex_base<T> &z, P) {
+  if constexpr (!detail::is_fast<P>) GSL_MATH_COUNT_CALL(inverse);
+  if constexpr (detail::is_fast<P>) {
+    return inverse<T>(z);
+  } else {
+    const T s = 1 / abs<T>(z, P{});
+    return complex_base<T>{(z.real() * s) * s, -(z.img() * s) * s};
+  }
+} /* r=1/z */
+
+template <typename T, accuracy::policy P>
+constexpr auto div(const complex_base<T> &a, const complex_base<T> &b, P) {
+  if constexpr (!detail::is_fast<P>) GSL_MATH_COUNT_CALL(div);
+  const T ar = a.real(), ai = a.img();
+  const T br = b.real(), bi = b.img();
+
+  if constexpr (detail::is_fast<P>) {
+    return div<T>(a, b);
+  } else if constexpr (detail::is_robust<P>) {
+    complex_base<T> r;
+    robust::div(ar, ai, br, bi, r.real(), r.img());
+    return r;
+  } else {
+    const T s = 1 / abs<T>(b, P{});
+    const T sbr = s * br;
+    const T sbi = s * bi;
+    return complex_base<T>{(ar * sbr + ai * sbi) * s,
+                           (ai * sbr - ar * sbi) * s};
+  }
+} /* r=a/b */
+
+/* Elementary Complex Functions */
+
+template <typename T, accuracy::policy P>
+constexpr auto sqrt(const complex_base<T> &a, P) {
+  if constexpr (!detail::is_fast<P>) GSL_MATH_COUNT_CALL(sqrt);
+  if constexpr (detail::is_fast<P>) {
+    return sqrt<T>(a);
+  } else {
+    complex_base<T> r;
+    robust::sqrt(a.real(), a.img(), r.real(), r.img());
+    return r;
+  }
+} /* r=sqrt(a) */
+
+template <typename T, accuracy::policy P>
+constexpr auto log(const complex_base<T> &z, P) {
+  if constexpr (!detail::is_fast<P>) GSL_MATH_COUNT_CALL(log);
+  if constexpr (detail::is_fast<P>) {
+    return log<T>(z);
+  } else {
+    return complex_base<T>{logabs<T>(z, P{}), arg<T>(z, P{})};
+  }
+} /* r=log(z) (base e) */
+
+template <typename T, accuracy::policy P>
+constexpr auto log10(const complex_base<T> &z, P) {
+  if constexpr (!detail::is_fast<P>) GSL_MATH_COUNT_CALL(log10);
+  if constexpr (detail::is_fast<P>) {
+    return log10<T>(z);
+  } else {
+    return log<T>(z, P{}) / real::ln10<T>;
+  }
+} /* r=log10(z) (base 10) */
+
+template <typename T, accuracy::policy P>
+constexpr auto pow(const complex_base<T> &a, const complex_base<T> &b, P) {
+  if constexpr (!detail::is_fast<P>) GSL_MATH_COUNT_CALL(pow);
+  if constexpr (detail::is_fast<P>) {
+    return pow<T>(a, b);
+  } else {
+    GSL_MATH_COUNT_PATH_IF(pow, special_case, a.real() == 0 && a.img() == 0);
+    if (a.real() == 0 && a.img() == 0) return complex_base<T>{};
+
+    const T logr = logabs<T>(a, P{});
+    const T theta = arg<T>(a, P{});
+    const T rho = real::exp(logr * b.real() - b.img() * theta);
+    const T beta = theta * b.real() + b.img() * logr;
+    return complex_base<T>{complex_base<T>::polar, rho, beta};
+  }
+} /* r=a^b */
+
+template <typename T, accuracy::policy P>
+constexpr auto pow_real(const complex_base<T> &a, T b, P) {
+  if constexpr (!detail::is_fast<P>) GSL_MATH_COUNT_CALL(pow_real);
+  if constexpr (detail::is_fast<P>) {
+    return pow_real<T>(a, b);
+  } else {
+    GSL_MATH_COUNT_PATH_IF(pow_real, special_case,
+                           a.real() == 0 && a.img() == 0);
+    if (a.real() == 0 && a.img() == 0) return complex_base<T>{};
+
+    const T logr = logabs<T>(a, P{});
+    const T theta = arg<T>(a, P{});
+    return complex_base<T>{complex_base<T>::polar, real::exp(logr * b),
+                           theta * b};
+  }
+} /* r=a^b */
+
+/* Inverse Complex Trigonometric Functions */
+
+template <typename T, accuracy::policy P>
+constexpr auto arcsin(const complex_base<T> &a, P) {
+  GSL_MATH_COUNT_CALL(arcsin);
+  using K = complex_base<T>;
+  if constexpr (!detail::is_robust<P>) {
+    const K s = sqrt<T>(1 - a * a, P{});
+    return K::NEG_I * log<T>(a * K::I + s, P{});
+  } else {
+    const auto h = robust::hull_prep(a.real(), a.img());
+    T re = real::atan2(h.num, h.den);
+    T im = real::log1p(h.l) + h.add;
+    robust::arcsin_finish(a.real(), a.img(), re, im);
+    return K{re, im};
+  }
+} /* r=arcsin(a) */
+
+template <typename T, accuracy::policy P>
+constexpr auto arccos(const complex_base<T> &a, P) {
+  GSL_MATH_COUNT_CALL(arccos);
+  using K = complex_base<T>;
+  if constexpr (!detail::is_robust<P>) {
+    const K s = sqrt<T>(1 - a * a, P{});
+    return K::NEG_I * log<T>(a + K::I * s, P{});
+  } else {
+    const auto h = robust::hull_prep(a.real(), a.img());
+    T re = real::atan2(h.den, h.num);
+    T im = real::log1p(h.l) + h.add;
+    robust::arccos_finish(a.real(), a.img(), re, im);
+    return K{re, im};
+  }
+} /* r=arccos(a) */
+
+template <typename T, accuracy::policy P>
+constexpr auto arctan(const complex_base<T> &a, P) {
+  GSL_MATH_COUNT_CALL(arctan);
+  using K = complex_base<T>;
+  if constexpr (!detail::is_robust<P>) {
+    return K::NEG_I * log<T>(div<T>(K::I - a, K::I + a, P{}), P{}) / 2;
+  } else {
+    const auto h = robust::arctan_prep(a.real(), a.img());
+    T re = real::atan2(h.num, h.den);
+    T im = real::log1p(h.v);
+    robust::arctan_finish(a.real(), a.img(), h.k, re, im);
+    return K{re, im};
+  }
+} /* r=arctan(a) */
+
+/* Inverse Complex Hyperbolic Functions */
+
+template <typename T, accuracy::policy P>
+constexpr auto arcsinh(const complex_base<T> &a, P) {
+  GSL_MATH_COUNT_CALL(arcsinh);
+  using K = complex_base<T>;
+  if constexpr (!detail::is_robust<P>) {
+    return log<T>(a + sqrt<T>(a * a + 1, P{}), P{});
+  } else {
+    /* -i arcsin(i a) */
+    const K z = arcsin<T>(K{-a.img(), a.real()}, P{});
+    return K{z.img(), -z.real()};
+  }
+} /* r=arcsinh(a) */
+
+template <typename T, accuracy::policy P>
+constexpr auto arccosh(const complex_base<T> &a, P) {
+  GSL_MATH_COUNT_CALL(arccosh);
+  using K = complex_base<T>;
+  if constexpr (!detail::is_robust<P>) {
+    return log<T>(a + sqrt<T>(a * a - 1, P{}), P{});
+  } else {
+    /* +-i arccos(a), the sign keeps the real part positive */
+    const K z = arccos<T>(a, P{});
+    return z.img() > 0 ? K{z.img(), -z.real()} : K{-z.img(), z.real()};
+  }
+} /* r=arccosh(a) */
+
+template <typename T, accuracy::policy P>
+constexpr auto arctanh(const complex_base<T> &a, P) {
+  GSL_MATH_COUNT_CALL(arctanh);
+  using K = complex_base<T>;
+  if constexpr (!detail::is_robust<P>) {
+    return log<T>(div<T>(1 + a, 1 - a, P{}), P{}) / 2;
+  } else {
+    /* -i arctan(i a) */
+    const K z = arctan<T>(K{-a.img(), a.real()}, P{});
+    return K{z.img(), -z.real()};
+  }
+} /* r=arctanh(a) */
+
+/* Deducing overloads of the tagged functions, sqrt(z, accuracy::robust)
+ * for any complex_like z, see the end of gsl/math/complex.h */
+
+#define GSL_MATH_COMPLEX_LIKE_TAGGED(name)                                \
+  template <gsl::type::complex_like Z, accuracy::policy P>                \
+  constexpr auto name(const Z &z, P) {                                    \
+    using T = gsl::type::complex_value_t<Z>;                              \
+    return gsl::type::as_complex_result<Z>(                               \
+        name<T>(gsl::type::as_complex_base(z), P{}));                     \
+  }
+
+#define GSL_MATH_COMPLEX_LIKE_TAGGED_BINARY(name)                         \
+  template <gsl::type::complex_like A, gsl::type::complex_like B,         \
+            accuracy::policy P>                                           \
+    requires std::same_as<gsl::type::complex_value_t<A>,                  \
+                          gsl::type::complex_value_t<B>>                  \
+  constexpr auto name(const A &a, const B &b, P) {                        \
+    using T = gsl::type::complex_value_t<A>;                              \
+    return gsl::type::as_complex_result<A>(                               \
+        name<T>(gsl::type::as_complex_base(a),                            \
+                gsl::type::as_complex_base(b), P{}));                     \
+  }
+
+GSL_MATH_COMPLEX_LIKE_TAGGED(arg)
+GSL_MATH_COMPLEX_LIKE_TAGGED(abs)
+GSL_MATH_COMPLEX_LIKE_TAGGED(logabs)
+GSL_MATH_COMPLEX_LIKE_TAGGED(inverse)
+GSL_MATH_COMPLEX_LIKE_TAGGED_BINARY(div)
+GSL_MATH_COMPLEX_LIKE_TAGGED(sqrt)
+GSL_MATH_COMPLEX_LIKE_TAGGED(log)
+GSL_MATH_COMPLEX_LIKE_TAGGED(log10)
+GSL_MATH_COMPLEX_LIKE_TAGGED_BINARY(pow)
+GSL_MATH_COMPLEX_LIKE_TAGGED(arcsin)
+GSL_MATH_COMPLEX_LIKE_TAGGED(arccos)
+GSL_MATH_COMPLEX_LIKE_TAGGED(arctan)
+GSL_MATH_COMPLEX_LIKE_TAGGED(arcsinh)
+GSL_MATH_COMPLEX_LIKE_TAGGED(arccosh)
+GSL_MATH_COMPLEX_LIKE_TAGGED(arctanh)
+
+template <gsl::type::complex_like Z, accuracy::policy P>
+constexpr auto pow_real(const Z &z, gsl::type::complex_value_t<Z> x, P) {
+  using T = gsl::type::complex_value_t<Z>;
+  return gsl::type::as_complex_result<Z>(
+      pow_real<T>(gsl::type::as_complex_base(z), x, P{}));
+}
+
+#undef GSL_MATH_COMPLEX_LIKE_TAGGED
+#undef GSL_MATH_COMPLEX_LIKE_TAGGED_BINARY
+
+}  // namespace gsl::math
@@ -23,9 +23,14 @@
 
 #include <gsl/constant/machine.h>
 #include <gsl/constant/math.h>
+#include <gsl/math/instrument.h>
+#include <gsl/math/real.h>
+#include <gsl/math/sincos.h>
 #include <gsl/type/complex.h>
+#include <gsl/type/complex_like.h>
 
 #include <cmath>
+#include <concepts>
 
 namespace gsl::math {
 
@@ -41,311 +46,495 @@ constexpr auto COMPLEX_NEGONE = complex::NEG_ONE;
 
 template <typename T = double>
 constexpr auto arg(const complex_base<T> &z) {
+  GSL_MATH_COUNT_CALL(arg);
   return z.angle_in_rads();
 } /* return arg(z), -pi< arg(z) <=+pi */
 
 template <typename T = double>
 constexpr auto abs(const complex_base<T> &z) {
+  GSL_MATH_COUNT_CALL(abs);
   return z.dist();
 } /* return |z|   */
 
 template <typename T = double>
 constexpr auto abs2(const complex_base<T> &z) {
+  GSL_MATH_COUNT_CALL(abs2);
   return z.norm();
 } /* return |z|^2 */
 
 template <typename T = double>
 constexpr auto logabs(const complex_base<T> &z) {
-  return log(z.dist());
+  GSL_MATH_COUNT_CALL(logabs);
+  return real::log(z.dist());
 } /* return log|z| */
 
 /* Complex arithmetic operators */
 
 template <typename T = double>
 constexpr auto add(const complex_base<T> &a, const complex_base<T> &b) {
+  GSL_MATH_COUNT_CALL(add);
   return a + b;
 } /* r=a+b */
 
 template <typename T = double>
 constexpr auto sub(const complex_base<T> &a, const complex_base<T> &b) {
+  GSL_MATH_COUNT_CALL(sub);
   return a - b;
 } /* r=a-b */
 
 template <typename T = double>
 constexpr auto mul(const complex_base<T> &a, const complex_base<T> &b) {
+  GSL_MATH_COUNT_CALL(mul);
   return a * b;
 } /* r=a*b */
 
 template <typename T = double>
 constexpr auto div(const complex_base<T> &a, const complex_base<T> &b) {
+  GSL_MATH_COUNT_CALL(div);
   return a / b;
 } /* r=a/b */
 
 template <typename T = double>
 constexpr auto add_real(const complex_base<T> &a, const T &b) {
+  GSL_MATH_COUNT_CALL(add_real);
   return a + b;
 } /* r=a+b */
 
 template <typename T = double>
 constexpr auto sub_real(const complex_base<T> &a, const T &b) {
+  GSL_MATH_COUNT_CALL(sub_real);
   return a - b;
 } /* r=a-b */
 
 template <typename T = double>
 constexpr auto mul_real(const complex_base<T> &a, const T &b) {
+  GSL_MATH_COUNT_CALL(mul_real);
   return a * b;
 } /* r=a*b */
 
 template <typename T = double>
 constexpr auto div_real(const complex_base<T> &a, const T &b) {
+  GSL_MATH_COUNT_CALL(div_real);
   return a / b;
 } /* r=a/b */
 
 template <typename T = double>
 constexpr auto add_imag(const complex_base<T> &a, const T &b) {
+  GSL_MATH_COUNT_CALL(add_imag);
   return a + complex_base<T>{0, b};
 } /* r=a+b */
 
 template <typename T = double>
 constexpr auto sub_imag(const complex_base<T> &a, const T &b) {
+  GSL_MATH_COUNT_CALL(sub_imag);
   return a + complex_base<T>{0, -b};
 } /* r=a-b */
 
 template <typename T = double>
 constexpr auto mul_imag(const complex_base<T> &a, const T &b) {
+  GSL_MATH_COUNT_CALL(mul_imag);
   return a * complex_base<T>{0, b};
 } /* r=a*b */
 
 template <typename T = double>
 constexpr auto div_imag(const complex_base<T> &a, const T &b) {
+  GSL_MATH_COUNT_CALL(div_imag);
   return a / complex_base<T>{0, b};
 } /* r=a/b */
 
 template <typename T = double>
 constexpr auto conjugate(const complex_base<T> &z) {
+  GSL_MATH_COUNT_CALL(conjugate);
   return z.congugate();
 } /* r=conj(z) */
 
 template <typename T = double>
 constexpr auto inverse(const complex_base<T> &z) {
+  GSL_MATH_COUNT_CALL(inverse);
   return z.inverse();
 } /* r=1/z */
 
 template <typename T = double>
 constexpr auto negative(const complex_base<T> &z) {
+  GSL_MATH_COUNT_CALL(negative);
   return z.neg();
 } /* r=-z */
 
 /* Elementary Complex Functions */
 
-template <typename T, typename K = complex_base<T>>
+template <typename T, std::same_as<complex_base<T>> K = complex_base<T>>
 constexpr auto sqrt(const K &v) {
-  return K(K::polar, ::sqrt(v.dist()), v.angle_in_rads() / 2.0);
+  GSL_MATH_COUNT_CALL(sqrt);
+  return K(K::polar, real::sqrt(v.dist()), v.angle_in_rads() / 2.0);
 }
 
-template <typename T, typename K = complex_base<T>>
-constexpr auto sqrt_real(const K &v) {
-  return sqrt(v.real());
+template <typename T, std::same_as<complex_base<T>> K = complex_base<T>>
+constexpr auto sqrt_real(T x) {
+  GSL_MATH_COUNT_CALL(sqrt_real);
+  return x >= 0 ? K{real::sqrt(x), 0} : K{0, real::sqrt(-x)};
 } /* r=sqrt(x) (x<0 ok) */
 
-template <typename T, typename K = complex_base<T>>
+template <typename T, std::same_as<complex_base<T>> K = complex_base<T>>
 constexpr auto pow(const K &v, const K &exponent) {
+  GSL_MATH_COUNT_CALL(pow);
   // return K(K::polar, pow(v.dist(), exponent), exponent * v.angle_in_rads());
   const auto m = v.dist();
   const auto r = v.angle_in_rads();
 
   return K{
-      K::polar,                                            //
-      pow(m, exponent.real()) * exp(-r * exponent.img()),  //
-      exponent.real() * r + exponent.img() * ln(m)         //
+      K::polar,                                                        //
+      real::pow(m, exponent.real()) * real::exp(-r * exponent.img()),  //
+      exponent.real() * r + exponent.img() * real::log(m)              //
   };
 } /* r=a^b  */
 
-template <typename T, typename K = complex_base<T>>
-constexpr auto pow_real(const K &v, T exponent) {
-  return K(K::polar, pow(v.dist(), exponent), exponent * v.angle_in_rads());
+template <typename T = double>
+constexpr auto pow_real(const complex_base<T> &v, T exponent) {
+  GSL_MATH_COUNT_CALL(pow_real);
+  using K = complex_base<T>;
+  return K(K::polar, real::pow(v.dist(), exponent),
+           exponent * v.angle_in_rads());
 } /* r=a^b  */
 
-template <typename T, typename K = complex_base<T>>
+template <typename T, std::same_as<complex_base<T>> K = complex_base<T>>
 constexpr auto exp(const K &a) {
-  return K{K::polar, ::exp(a.real()), a.img()};
+  GSL_MATH_COUNT_CALL(exp);
+  return K{K::polar, real::exp(a.real()), a.img()};
 } /* r=exp(a) */
 
-template <typename T, typename K = complex_base<T>>
-auto log(const K &z) {
-  return K{::log(z.dist()), z.angle_in_rads()};
+template <typename T, std::same_as<complex_base<T>> K = complex_base<T>>
+constexpr auto log(const K &z) {
+  GSL_MATH_COUNT_CALL(log);
+  return K{real::log(z.dist()), z.angle_in_rads()};
 } /* r=log(z) (base e) */
 
-template <typename T, typename K = complex_base<T>>
-auto log10(const K &z) {
-  using gsl::constant::math::LN10;
-  return K{::log(z.dist()) / LN10, z.angle_in_rads() / LN10};
+template <typename T, std::same_as<complex_base<T>> K = complex_base<T>>
+constexpr auto log10(const K &z) {
+  GSL_MATH_COUNT_CALL(log10);
+  return K{real::log(z.dist()) / real::ln10<T>,
+           z.angle_in_rads() / real::ln10<T>};
 } /* r=log10(z) (base 10) */
 
-template <typename T, typename K = complex_base<T>>
+template <typename T, std::same_as<complex_base<T>> K = complex_base<T>>
 constexpr auto log_b(const K &a, const K &b) {
+  GSL_MATH_COUNT_CALL(log_b);
   return K{0};
 
 } /* r=log_b(a) (base=b) */
 
 /* Complex Trigonometric Functions */
 
-template <typename T, typename K = complex_base<T>>
+template <typename T, std::same_as<complex_base<T>> K = complex_base<T>>
 constexpr auto sin(const K &a) {
-  return K{::sin(a.real()) * ::cosh(a.img()),
-           ::cos(a.real()) * ::sinh(a.img())};
+  GSL_MATH_COUNT_CALL(sin);
+  const auto x = sincos(a.real());
+  const auto y = sinhcosh(a.img());
+  return K{x.sin * y.cosh, x.cos * y.sinh};
 } /* r=sin(a) */
 
-template <typename T, typename K = complex_base<T>>
+template <typename T, std::same_as<complex_base<T>> K = complex_base<T>>
 constexpr auto cos(const K &a) {
-  return K{::cos(a.real()) * ::cosh(a.img()),
-           -::sin(a.real()) * ::sinh(a.img())};
+  GSL_MATH_COUNT_CALL(cos);
+  const auto x = sincos(a.real());
+  const auto y = sinhcosh(a.img());
+  return K{x.cos * y.cosh, -x.sin * y.sinh};
 } /* r=cos(a) */
 
-template <typename T, typename K = complex_base<T>>
+template <typename T, std::same_as<complex_base<T>> K = complex_base<T>>
 constexpr auto sec(const K &a) {
+  GSL_MATH_COUNT_CALL(sec);
   return 1 / sin<T>(a);
 } /* r=sec(a) */
 
-template <typename T, typename K = complex_base<T>>
+template <typename T, std::same_as<complex_base<T>> K = complex_base<T>>
 constexpr auto csc(const K &a) {
+  GSL_MATH_COUNT_CALL(csc);
   return 1 / cos<T>(a);
 } /* r=csc(a) */
 
-template <typename T, typename K = complex_base<T>>
+template <typename T, std::same_as<complex_base<T>> K = complex_base<T>>
 constexpr auto tan(const K &a) {
-  return sin<T>(a) / cos<T>(a);
+  GSL_MATH_COUNT_CALL(tan);
+  const auto x = sincos(a.real());
+  const auto y = sinhcosh(a.img());
+
+  if (real::fabs(a.img()) < 1) {
+    const T d = x.cos * x.cos + y.sinh * y.sinh;
+    return K{x.sin * x.cos / d, y.sinh * y.cosh / d};
+  }
+
+  /* sinh^2 overflows long before tan(a) stops being finite */
+  GSL_MATH_COUNT_PATH(tan, overflow);
+  const T c = 1 / y.sinh;
+  const T s = c * c;
+  const T d = 1 + x.cos * x.cos * s;
+  return K{x.sin * x.cos * s / d, y.cosh / y.sinh / d};
 } /* r=tan(a) */
 
-template <typename T, typename K = complex_base<T>>
+template <typename T, std::same_as<complex_base<T>> K = complex_base<T>>
 constexpr auto cot(const K &a) {
+  GSL_MATH_COUNT_CALL(cot);
   return cos<T>(a) / sin<T>(a);
 } /* r=cot(a) */
 
 /* Inverse Complex Trigonometric Functions */
 
-template <typename T, typename K = complex_base<T>>
+template <typename T, std::same_as<complex_base<T>> K = complex_base<T>>
 constexpr auto arcsin(const K &a) {
-  return K::NEG_I * log<T>(a * K::I + (1 - a * a).sqrt());
+  GSL_MATH_COUNT_CALL(arcsin);
+  return K::NEG_I * log<T>(a * K::I + sqrt<T>(1 - a * a));
 } /* r=arcsin(a) */
 
-template <typename T, typename K = complex_base<T>>
-constexpr auto arcsin_real(double a) {
+template <typename T, std::same_as<complex_base<T>> K = complex_base<T>>
+constexpr auto arcsin_real(T a) {
+  GSL_MATH_COUNT_CALL(arcsin_real);
   return K{};
 } /* r=arcsin(a) */
 
-template <typename T, typename K = complex_base<T>>
+template <typename T, std::same_as<complex_base<T>> K = complex_base<T>>
 constexpr auto arccos(const K &a) {
-  return K::NEG_I * log<T>(a + K::I * (1 - a * a).sqrt());
+  GSL_MATH_COUNT_CALL(arccos);
+  return K::NEG_I * log<T>(a + K::I * sqrt<T>(1 - a * a));
 } /* r=arccos(a) */
 
-template <typename T, typename K = complex_base<T>>
-constexpr auto arccos_real(double a) {
+template <typename T, std::same_as<complex_base<T>> K = complex_base<T>>
+constexpr auto arccos_real(T a) {
+  GSL_MATH_COUNT_CALL(arccos_real);
   return K{};
 } /* r=arccos(a) */
 
-template <typename T, typename K = complex_base<T>>
+template <typename T, std::same_as<complex_base<T>> K = complex_base<T>>
 constexpr auto arcsec(const K &a) {
+  GSL_MATH_COUNT_CALL(arcsec);
   return K{};
 } /* r=arcsec(a) */
 
-template <typename T, typename K = complex_base<T>>
-constexpr auto arcsec_real(double a) {
+template <typename T, std::same_as<complex_base<T>> K = complex_base<T>>
+constexpr auto arcsec_real(T a) {
+  GSL_MATH_COUNT_CALL(arcsec_real);
   return K{};
 } /* r=arcsec(a) */
 
-template <typename T, typename K = complex_base<T>>
+template <typename T, std::same_as<complex_base<T>> K = complex_base<T>>
 constexpr auto arccsc(const K &a) {
+  GSL_MATH_COUNT_CALL(arccsc);
   return K{};
 } /* r=arccsc(a) */
 
-template <typename T, typename K = complex_base<T>>
-constexpr auto arccsc_real(double a) {
+template <typename T, std::same_as<complex_base<T>> K = complex_base<T>>
+constexpr auto arccsc_real(T a) {
+  GSL_MATH_COUNT_CALL(arccsc_real);
   return K{};
 } /* r=arccsc(a) */
 
-template <typename T, typename K = complex_base<T>>
+template <typename T, std::same_as<complex_base<T>> K = complex_base<T>>
 constexpr auto arctan(const K &a) {
+  GSL_MATH_COUNT_CALL(arctan);
   return K::NEG_I * log<T>((K::I - a) / (K::I + a)) / 2;
 } /* r=arctan(a) */
 
-template <typename T, typename K = complex_base<T>>
+template <typename T, std::same_as<complex_base<T>> K = complex_base<T>>
 constexpr auto arccot(const K &a) {
+  GSL_MATH_COUNT_CALL(arccot);
   return K::NEG_I * log<T>((K::I + a) / (K::I - a)) / 2;
 } /* r=arccot(a) */
 
 /* Complex Hyperbolic Functions */
 
-template <typename T, typename K = complex_base<T>>
+template <typename T, std::same_as<complex_base<T>> K = complex_base<T>>
 constexpr auto sinh(const K &a) {
-  return K::NEG_I * sin<T>(a * K::I);
+  GSL_MATH_COUNT_CALL(sinh);
+  const auto x = sinhcosh(a.real());
+  const auto y = sincos(a.img());
+  return K{x.sinh * y.cos, x.cosh * y.sin};
 } /* r=sinh(a) */
 
-template <typename T, typename K = complex_base<T>>
+template <typename T, std::same_as<complex_base<T>> K = complex_base<T>>
 constexpr auto cosh(const K &a) {
-  return cos<T>(a * K::I);
+  GSL_MATH_COUNT_CALL(cosh);
+  const auto x = sinhcosh(a.real());
+  const auto y = sincos(a.img());
+  return K{x.cosh * y.cos, x.sinh * y.sin};
 } /* r=coshh(a) */
 
-template <typename T, typename K = complex_base<T>>
+template <typename T, std::same_as<complex_base<T>> K = complex_base<T>>
 constexpr auto sech(const K &a) {
+  GSL_MATH_COUNT_CALL(sech);
   return 1 / sinh<T>(a);
 } /* r=sech(a) */
 
-template <typename T, typename K = complex_base<T>>
+template <typename T, std::same_as<complex_base<T>> K = complex_base<T>>
 constexpr auto csch(const K &a) {
+  GSL_MATH_COUNT_CALL(csch);
   return 1 / cosh<T>(a);
 } /* r=csch(a) */
 
-template <typename T, typename K = complex_base<T>>
+template <typename T, std::same_as<complex_base<T>> K = complex_base<T>>
 constexpr auto tanh(const K &a) {
-  return sinh<T>(a) / cosh<T>(a);
+  GSL_MATH_COUNT_CALL(tanh);
+  const auto x = sinhcosh(a.real());
+  const auto y = sincos(a.img());
+  const T d = y.cos * y.cos + x.sinh * x.sinh;
+
+  if (real::fabs(a.real()) < 1) {
+    return K{x.sinh * x.cosh / d, y.sin * y.cos / d};
+  }
+
+  GSL_MATH_COUNT_PATH(tanh, overflow);
+  const T f = 1 + (y.cos / x.sinh) * (y.cos / x.sinh);
+  return K{x.cosh / x.sinh / f, y.sin * y.cos / d};
 } /* r=tanh(a) */
 
-template <typename T, typename K = complex_base<T>>
+template <typename T, std::same_as<complex_base<T>> K = complex_base<T>>
 constexpr auto coth(const K &a) {
+  GSL_MATH_COUNT_CALL(coth);
   return cosh<T>(a) / sinh<T>(a);
 } /* r=coth(a) */
 
 /* Inverse Complex Hyperbolic Functions */
 
-template <typename T, typename K = complex_base<T>>
+template <typename T, std::same_as<complex_base<T>> K = complex_base<T>>
 constexpr auto arcsinh(const K &a) {
-  return log<T>(a + (a * a + 1).sqrt());
+  GSL_MATH_COUNT_CALL(arcsinh);
+  return log<T>(a + sqrt<T>(a * a + 1));
 } /* r=arcsinh(a) */
 
-template <typename T, typename K = complex_base<T>>
+template <typename T, std::same_as<complex_base<T>> K = complex_base<T>>
 constexpr auto arccosh(const K &a) {
-  return log<T>(a + (a * a - 1).sqrt());
+  GSL_MATH_COUNT_CALL(arccosh);
+  return log<T>(a + sqrt<T>(a * a - 1));
 } /* r=arccosh(a) */
 
-template <typename T, typename K = complex_base<T>>
-constexpr auto arccosh_real(double a) {
+template <typename T, std::same_as<complex_base<T>> K = complex_base<T>>
+constexpr auto arccosh_real(T a) {
+  GSL_MATH_COUNT_CALL(arccosh_real);
   return K{};
 } /* r=arccosh(a) */
 
-template <typename T, typename K = complex_base<T>>
+template <typename T, std::same_as<complex_base<T>> K = complex_base<T>>
 constexpr auto arcsech(const K &a) {
+  GSL_MATH_COUNT_CALL(arcsech);
   return K{};
 } /* r=arcsech(a) */
 
-template <typename T, typename K = complex_base<T>>
+template <typename T, std::same_as<complex_base<T>> K = complex_base<T>>
 constexpr auto arccsch(const K &a) {
+  GSL_MATH_COUNT_CALL(arccsch);
   return K{};
 } /* r=arccsch(a) */
 
-template <typename T, typename K = complex_base<T>>
+template <typename T, std::same_as<complex_base<T>> K = complex_base<T>>
 constexpr auto arctanh(const K &a) {
+  GSL_MATH_COUNT_CALL(arctanh);
   return log<T>((1 + a) / (1 - a)) / 2;
 } /* r=arctanh(a) */
 
-template <typename T, typename K = complex_base<T>>
-constexpr auto arctanh_real(double a) {
+template <typename T, std::same_as<complex_base<T>> K = complex_base<T>>
+constexpr auto arctanh_real(T a) {
+  GSL_MATH_COUNT_CALL(arctanh_real);
   return K{};
 } /* r=arctanh(a) */
 
-template <typename T, typename K = complex_base<T>>
+template <typename T, std::same_as<complex_base<T>> K = complex_base<T>>
 constexpr auto arccoth(const K &a) {
+  GSL_MATH_COUNT_CALL(arccoth);
   return K{};
 } /* r=arccoth(a) */
 
+/* Deducing overloads
+ *
+ * The functions above take the element type as a template argument,
+ * sqrt<double>(z). These take any complex_like argument (see
+ * gsl/type/complex_like.h) and deduce it, sqrt(z) for a complex_base<T>, a
+ * std::complex<T> or a complex_array<T> element, with the result in the
+ * same type (a complex_base<T> for the elements). A complex_base<T> is
+ * passed on by reference, the other types are read through complex_traits;
+ * both inline to the same code. Binary functions take two complex_like
+ * arguments of the same T and give the result in the type of the first. */
+
+#define GSL_MATH_COMPLEX_LIKE_UNARY(name)                                 \
+  template <gsl::type::complex_like Z>                                    \
+  constexpr auto name(const Z &z) {                                       \
+    using T = gsl::type::complex_value_t<Z>;                              \
+    return gsl::type::as_complex_result<Z>(                               \
+        name<T>(gsl::type::as_complex_base(z)));                          \
+  }
+
+#define GSL_MATH_COMPLEX_LIKE_BINARY(name)                                \
+  template <gsl::type::complex_like A, gsl::type::complex_like B>         \
+    requires std::same_as<gsl::type::complex_value_t<A>,                  \
+                          gsl::type::complex_value_t<B>>                  \
+  constexpr auto name(const A &a, const B &b) {                           \
+    using T = gsl::type::complex_value_t<A>;                              \
+    return gsl::type::as_complex_result<A>(name<T>(                       \
+        gsl::type::as_complex_base(a), gsl::type::as_complex_base(b)));   \
+  }
+
+#define GSL_MATH_COMPLEX_LIKE_WITH_REAL(name)                             \
+  template <gsl::type::complex_like Z>                                    \
+  constexpr auto name(const Z &z, gsl::type::complex_value_t<Z> x) {      \
+    using T = gsl::type::complex_value_t<Z>;                              \
+    return gsl::type::as_complex_result<Z>(                               \
+        name<T>(gsl::type::as_complex_base(z), x));                       \
+  }
+
+GSL_MATH_COMPLEX_LIKE_UNARY(arg)
+GSL_MATH_COMPLEX_LIKE_UNARY(abs)
+GSL_MATH_COMPLEX_LIKE_UNARY(abs2)
+GSL_MATH_COMPLEX_LIKE_UNARY(logabs)
+
+GSL_MATH_COMPLEX_LIKE_BINARY(add)
+GSL_MATH_COMPLEX_LIKE_BINARY(sub)
+GSL_MATH_COMPLEX_LIKE_BINARY(mul)
+GSL_MATH_COMPLEX_LIKE_BINARY(div)
+GSL_MATH_COMPLEX_LIKE_WITH_REAL(add_real)
+GSL_MATH_COMPLEX_LIKE_WITH_REAL(sub_real)
+GSL_MATH_COMPLEX_LIKE_WITH_REAL(mul_real)
+GSL_MATH_COMPLEX_LIKE_WITH_REAL(div_real)
+GSL_MATH_COMPLEX_LIKE_WITH_REAL(add_imag)
+GSL_MATH_COMPLEX_LIKE_WITH_REAL(sub_imag)
+GSL_MATH_COMPLEX_LIKE_WITH_REAL(mul_imag)
+GSL_MATH_COMPLEX_LIKE_WITH_REAL(div_imag)
+GSL_MATH_COMPLEX_LIKE_UNARY(conjugate)
+GSL_MATH_COMPLEX_LIKE_UNARY(inverse)
+GSL_MATH_COMPLEX_LIKE_UNARY(negative)
+
+GSL_MATH_COMPLEX_LIKE_UNARY(sqrt)
+GSL_MATH_COMPLEX_LIKE_BINARY(pow)
+GSL_MATH_COMPLEX_LIKE_WITH_REAL(pow_real)
+GSL_MATH_COMPLEX_LIKE_UNARY(exp)
+GSL_MATH_COMPLEX_LIKE_UNARY(log)
+GSL_MATH_COMPLEX_LIKE_UNARY(log10)
+GSL_MATH_COMPLEX_LIKE_BINARY(log_b)
+
+GSL_MATH_COMPLEX_LIKE_UNARY(sin)
+GSL_MATH_COMPLEX_LIKE_UNARY(cos)
+GSL_MATH_COMPLEX_LIKE_UNARY(sec)
+GSL_MATH_COMPLEX_LIKE_UNARY(csc)
+GSL_MATH_COMPLEX_LIKE_UNARY(tan)
+GSL_MATH_COMPLEX_LIKE_UNARY(cot)
+GSL_MATH_COMPLEX_LIKE_UNARY(arcsin)
+GSL_MATH_COMPLEX_LIKE_UNARY(arccos)
+GSL_MATH_COMPLEX_LIKE_UNARY(arcsec)
+GSL_MATH_COMPLEX_LIKE_UNARY(arccsc)
+GSL_MATH_COMPLEX_LIKE_UNARY(arctan)
+GSL_MATH_COMPLEX_LIKE_UNARY(arccot)
+
+GSL_MATH_COMPLEX_LIKE_UNARY(sinh)
+GSL_MATH_COMPLEX_LIKE_UNARY(cosh)
+GSL_MATH_COMPLEX_LIKE_UNARY(sech)
+GSL_MATH_COMPLEX_LIKE_UNARY(csch)
+GSL_MATH_COMPLEX_LIKE_UNARY(tanh)
+GSL_MATH_COMPLEX_LIKE_UNARY(coth)
+GSL_MATH_COMPLEX_LIKE_UNARY(arcsinh)
+GSL_MATH_COMPLEX_LIKE_UNARY(arccosh)
+GSL_MATH_COMPLEX_LIKE_UNARY(arcsech)
+GSL_MATH_COMPLEX_LIKE_UNARY(arccsch)
+GSL_MATH_COMPLEX_LIKE_UNARY(arctanh)
+GSL_MATH_COMPLEX_LIKE_UNARY(arccoth)
+
+#undef GSL_MATH_COMPLEX_LIKE_UNARY
+#undef GSL_MATH_COMPLEX_LIKE_BINARY
+#undef GSL_MATH_COMPLEX_LIKE_WITH_REAL
+
 }  // namespace gsl::math
\ No newline at end of file
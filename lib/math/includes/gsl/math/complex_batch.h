@@ -0,0 +1,1036 @@
+#pragma once
+
+#include <gsl/math/accuracy.h>
+#include <gsl/math/complex.h>
+#include <gsl/math/dispatch.h>
+#include <gsl/math/half.h>
+#include <gsl/math/instrument.h>
+#include <gsl/math/real.h>
+#include <gsl/math/robust.h>
+#include <gsl/math/sincos.h>
+#include <gsl/type/complex.h>
+#include <gsl/type/polar_complex.h>
+#include <gsl/type/type_info.h>
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <span>
+
+namespace gsl::math {
+
+using gsl::type::polar_complex;
+
+/* Batch versions of the functions in gsl/math/complex.h
+ *
+ * Every function f of gsl/math/complex.h gets the overloads
+ *
+ *   f<T>(std::span<const complex_base<T>> in, std::span<complex_base<T>> out)
+ *   f<T>(std::span<complex_base<T>> inout)
+ *
+ * (binary functions take a second input span, functions with a real
+ * argument or a real result take std::span<const T> / std::span<T> on that
+ * side and have no in-place form). min(in.size(), out.size()) elements are
+ * processed.
+ *
+ * The input is processed in blocks of BLOCK_SIZE elements. Each block is
+ * split into separate real and imaginary arrays, the kernel runs straight
+ * loops over those arrays, and the result is interleaved back into the
+ * output. The loops have no branches around calls, so the compiler can
+ * vectorize them: the arithmetic ones always, the ones calling real::exp,
+ * log, sin, cos, atan2, ... only where it has vector versions of those (the
+ * dispatched kernels below with libmvec, see src/complex_batch.cpp), else
+ * they make one libm call per element.
+ *
+ * For float and double the split kernels are compiled into gsl-lib-math
+ * once per instruction set and picked at runtime, see gsl/math/dispatch.h.
+ *
+ * The storage scalars float16 and bfloat16 (gsl/math/half.h) run the float
+ * kernels: each block is widened to float when it is split and narrowed
+ * again when it is interleaved, only the 16 bit data is read and written.
+ *
+ * sqrt, logabs, div and the inverse trigonometric and hyperbolic functions
+ * (but the sec/csc/cot ones) also take accuracy::robust as a last argument.
+ * Those kernels run the stages of gsl/math/robust.h as loops and give the
+ * same results as the robust tier of gsl/math/accuracy.h.
+ *
+ * to_polar and from_polar convert between complex_base<T> and
+ * gsl::type::polar_complex<T> spans with the abs, arg and polar kernels.
+ *
+ * In instrumented builds every call records its size in the batch histogram
+ * of the function, see gsl/math/instrument.h. */
+
+namespace batch {
+
+constexpr std::size_t BLOCK_SIZE = 256;
+
+/* the blocks are aligned for the widest variant of the kernels */
+template <typename T>
+constexpr std::size_t ALIGNMENT =
+    gsl::type::simd_info<T, dispatch::widest>::alignment;
+
+template <typename T>
+struct split_block {
+  alignas(ALIGNMENT<T>) T re[BLOCK_SIZE];
+  alignas(ALIGNMENT<T>) T im[BLOCK_SIZE];
+};
+
+/* complex_base<T> is laid out as (real, imag), the drivers below work on
+ * that interleaved layout through plain T pointers */
+template <typename T>
+const T *raw(std::span<const complex_base<T>> v) {
+  return reinterpret_cast<const T *>(v.data());
+}
+
+template <typename T>
+T *raw(std::span<complex_base<T>> v) {
+  return reinterpret_cast<T *>(v.data());
+}
+
+/* conversion of n storage scalars to and from the compute type, the
+ * dispatched variants replace it with the conversion instructions */
+struct convert {
+  template <typename S, typename T>
+  static constexpr void widen(const S *in, T *out, std::size_t n) {
+    for (std::size_t i = 0; i < n; i++) {
+      out[i] = static_cast<T>(in[i]);
+    }
+  }
+
+  template <typename T, typename S>
+  static constexpr void narrow(const T *in, S *out, std::size_t n) {
+    for (std::size_t i = 0; i < n; i++) {
+      out[i] = static_cast<S>(in[i]);
+    }
+  }
+};
+
+template <typename Io = convert, typename T, typename S>
+constexpr void load(split_block<T> &b, const S *in, std::size_t n) {
+  if constexpr (std::same_as<S, T>) {
+    for (std::size_t i = 0; i < n; i++) {
+      b.re[i] = in[2 * i];
+      b.im[i] = in[2 * i + 1];
+    }
+  } else {
+    alignas(ALIGNMENT<T>) T w[2 * BLOCK_SIZE];
+    Io::widen(in, w, 2 * n);
+    load(b, w, n);
+  }
+}
+
+template <typename Io = convert, typename T, typename S>
+constexpr void store(const split_block<T> &b, S *out, std::size_t n) {
+  if constexpr (std::same_as<S, T>) {
+    for (std::size_t i = 0; i < n; i++) {
+      out[2 * i] = b.re[i];
+      out[2 * i + 1] = b.im[i];
+    }
+  } else {
+    alignas(ALIGNMENT<T>) T w[2 * BLOCK_SIZE];
+    store(b, w, n);
+    Io::narrow(w, out, 2 * n);
+  }
+}
+
+constexpr std::size_t block_length(std::size_t n, std::size_t i) {
+  return n - i < BLOCK_SIZE ? n - i : BLOCK_SIZE;
+}
+
+/* Block drivers, the signatures match dispatch::kernels<T>. T is the
+ * stored type, the kernels run on compute_type<T> */
+
+template <typename T, auto Kernel, typename Io = convert>
+void unary(const T *in, T *out, std::size_t n) {
+  split_block<compute_type<T>> x, y;
+  for (std::size_t i = 0; i < n; i += BLOCK_SIZE) {
+    const auto m = block_length(n, i);
+    load<Io>(x, in + 2 * i, m);
+    Kernel(x.re, x.im, y.re, y.im, m);
+    store<Io>(y, out + 2 * i, m);
+  }
+}
+
+template <typename T, auto Kernel, typename Io = convert>
+void to_real(const T *in, T *out, std::size_t n) {
+  using C = compute_type<T>;
+  split_block<C> x;
+  for (std::size_t i = 0; i < n; i += BLOCK_SIZE) {
+    const auto m = block_length(n, i);
+    load<Io>(x, in + 2 * i, m);
+    if constexpr (std::same_as<T, C>) {
+      Kernel(x.re, x.im, out + i, m);
+    } else {
+      alignas(ALIGNMENT<C>) C y[BLOCK_SIZE];
+      Kernel(x.re, x.im, y, m);
+      Io::narrow(y, out + i, m);
+    }
+  }
+}
+
+template <typename T, auto Kernel, typename Io = convert>
+void from_real(const T *in, T *out, std::size_t n) {
+  using C = compute_type<T>;
+  split_block<C> y;
+  for (std::size_t i = 0; i < n; i += BLOCK_SIZE) {
+    const auto m = block_length(n, i);
+    if constexpr (std::same_as<T, C>) {
+      Kernel(in + i, y.re, y.im, m);
+    } else {
+      alignas(ALIGNMENT<C>) C x[BLOCK_SIZE];
+      Io::widen(in + i, x, m);
+      Kernel(x, y.re, y.im, m);
+    }
+    store<Io>(y, out + 2 * i, m);
+  }
+}
+
+template <typename T, auto Kernel, typename Io = convert>
+void binary(const T *a, const T *b, T *out, std::size_t n) {
+  split_block<compute_type<T>> x, y, z;
+  for (std::size_t i = 0; i < n; i += BLOCK_SIZE) {
+    const auto m = block_length(n, i);
+    load<Io>(x, a + 2 * i, m);
+    load<Io>(y, b + 2 * i, m);
+    Kernel(x.re, x.im, y.re, y.im, z.re, z.im, m);
+    store<Io>(z, out + 2 * i, m);
+  }
+}
+
+template <typename T, auto Kernel, typename Io = convert>
+void with_real(const T *a, T s, T *out, std::size_t n) {
+  using C = compute_type<T>;
+  split_block<C> x, y;
+  for (std::size_t i = 0; i < n; i += BLOCK_SIZE) {
+    const auto m = block_length(n, i);
+    load<Io>(x, a + 2 * i, m);
+    Kernel(x.re, x.im, static_cast<C>(s), y.re, y.im, m);
+    store<Io>(y, out + 2 * i, m);
+  }
+}
+
+/* run the bound variant for float/double, the generic driver otherwise */
+template <typename T, typename Fn, typename... Args>
+void call(Fn dispatch::kernels<T>::*entry, Fn generic, Args... args) {
+  if constexpr (dispatch::is_dispatched<T>) {
+    (dispatch::table<T>().*entry)(args...);
+  } else {
+    generic(args...);
+  }
+}
+
+/* the value in the compute type of its scalar */
+template <typename T>
+constexpr compute_type<T> widen(T x) {
+  return x;
+}
+
+template <typename T>
+constexpr complex_base<compute_type<T>> widen(const complex_base<T> &z) {
+  return complex_base<compute_type<T>>(z);
+}
+
+/* fallback for functions without a split kernel: call the scalar function
+ * on every element (widened for the storage scalars) */
+template <typename In, typename Out, typename F>
+constexpr void map(std::span<const In> in, std::span<Out> out, F f) {
+  const auto n = std::min(in.size(), out.size());
+  for (std::size_t i = 0; i < n; i++) {
+    out[i] = static_cast<Out>(f(widen(in[i])));
+  }
+}
+
+template <typename T, typename F>
+constexpr void map(std::span<const complex_base<T>> a,
+                   std::span<const complex_base<T>> b,
+                   std::span<complex_base<T>> out, F f) {
+  const auto n = std::min({a.size(), b.size(), out.size()});
+  for (std::size_t i = 0; i < n; i++) {
+    out[i] = static_cast<complex_base<T>>(f(widen(a[i]), widen(b[i])));
+  }
+}
+
+/* Split kernels, x = input, y = output, each one mirrors the formula of the
+ * scalar function with the same name */
+
+template <typename T>
+void conjugate(const T *xr, const T *xi, T *yr, T *yi, std::size_t n) {
+  for (std::size_t i = 0; i < n; i++) {
+    yr[i] = xr[i];
+    yi[i] = -xi[i];
+  }
+}
+
+template <typename T>
+void negative(const T *xr, const T *xi, T *yr, T *yi, std::size_t n) {
+  for (std::size_t i = 0; i < n; i++) {
+    yr[i] = -xr[i];
+    yi[i] = -xi[i];
+  }
+}
+
+template <typename T>
+void inverse(const T *xr, const T *xi, T *yr, T *yi, std::size_t n) {
+  for (std::size_t i = 0; i < n; i++) {
+    const T d = 1 / (xr[i] * xr[i] + xi[i] * xi[i]);
+    yr[i] = xr[i] * d;
+    yi[i] = -xi[i] * d;
+  }
+}
+
+template <typename T>
+void abs2(const T *xr, const T *xi, T *y, std::size_t n) {
+  for (std::size_t i = 0; i < n; i++) {
+    y[i] = xr[i] * xr[i] + xi[i] * xi[i];
+  }
+}
+
+template <typename T>
+void abs(const T *xr, const T *xi, T *y, std::size_t n) {
+  abs2(xr, xi, y, n);
+  for (std::size_t i = 0; i < n; i++) {
+    y[i] = real::sqrt(y[i]);
+  }
+}
+
+template <typename T>
+void logabs(const T *xr, const T *xi, T *y, std::size_t n) {
+  abs(xr, xi, y, n);
+  for (std::size_t i = 0; i < n; i++) {
+    y[i] = real::log(y[i]);
+  }
+}
+
+template <typename T>
+void arg(const T *xr, const T *xi, T *y, std::size_t n) {
+  for (std::size_t i = 0; i < n; i++) {
+    const T a = real::atan2(xi[i], xr[i]);
+    y[i] = (xr[i] == 0 && xi[i] == 0) ? 0 : a;
+  }
+}
+
+/* y = m * (cos(t) + i sin(t)) with m in yr and t in yi
+ *
+ * sin and cos run in loops of their own: there are vector versions of both
+ * but not of sincos, which GCC would fold them into in a single loop */
+template <typename T>
+void polar(T *yr, T *yi, std::size_t n) {
+  alignas(ALIGNMENT<T>) T c[BLOCK_SIZE];
+  for (std::size_t i = 0; i < n; i++) {
+    GSL_MATH_COUNT_CALL(sincos);
+    GSL_MATH_COUNT_PATH_IF(sincos, large_reduction,
+                           real::fabs(yi[i]) >= instrument::large_reduction<T>);
+    c[i] = real::cos(yi[i]);
+  }
+  for (std::size_t i = 0; i < n; i++) {
+    yi[i] = yr[i] * real::sin(yi[i]);
+    yr[i] = yr[i] * c[i];
+  }
+}
+
+/* (|x|, arg x) pairs and back, the layout of gsl::type::polar_complex */
+template <typename T>
+void to_polar(const T *xr, const T *xi, T *yr, T *yi, std::size_t n) {
+  abs(xr, xi, yr, n);
+  arg(xr, xi, yi, n);
+}
+
+template <typename T>
+void from_polar(const T *xr, const T *xi, T *yr, T *yi, std::size_t n) {
+  for (std::size_t i = 0; i < n; i++) {
+    yr[i] = xr[i];
+    yi[i] = xi[i];
+  }
+  polar(yr, yi, n);
+}
+
+template <typename T>
+void sqrt_real(const T *x, T *yr, T *yi, std::size_t n) {
+  for (std::size_t i = 0; i < n; i++) {
+    const T s = real::sqrt(x[i] >= 0 ? x[i] : -x[i]);
+    yr[i] = x[i] >= 0 ? s : 0;
+    yi[i] = x[i] >= 0 ? 0 : s;
+  }
+}
+
+template <typename T>
+void sqrt(const T *xr, const T *xi, T *yr, T *yi, std::size_t n) {
+  abs(xr, xi, yr, n);
+  arg(xr, xi, yi, n);
+  for (std::size_t i = 0; i < n; i++) {
+    yr[i] = real::sqrt(yr[i]);
+    yi[i] = yi[i] / 2;
+  }
+  polar(yr, yi, n);
+}
+
+template <typename T>
+void exp(const T *xr, const T *xi, T *yr, T *yi, std::size_t n) {
+  for (std::size_t i = 0; i < n; i++) {
+    yr[i] = real::exp(xr[i]);
+    yi[i] = xi[i];
+  }
+  polar(yr, yi, n);
+}
+
+template <typename T>
+void log(const T *xr, const T *xi, T *yr, T *yi, std::size_t n) {
+  logabs(xr, xi, yr, n);
+  arg(xr, xi, yi, n);
+}
+
+template <typename T>
+void log10(const T *xr, const T *xi, T *yr, T *yi, std::size_t n) {
+  log(xr, xi, yr, yi, n);
+  for (std::size_t i = 0; i < n; i++) {
+    yr[i] = yr[i] / real::ln10<T>;
+    yi[i] = yi[i] / real::ln10<T>;
+  }
+}
+
+/* sin and cos of x into s.re and s.im, apart as in polar */
+template <typename T>
+void sincos(const T *x, split_block<T> &s, std::size_t n) {
+  for (std::size_t i = 0; i < n; i++) {
+    GSL_MATH_COUNT_CALL(sincos);
+    GSL_MATH_COUNT_PATH_IF(sincos, large_reduction,
+                           real::fabs(x[i]) >= instrument::large_reduction<T>);
+    s.re[i] = real::sin(x[i]);
+  }
+  for (std::size_t i = 0; i < n; i++) {
+    s.im[i] = real::cos(x[i]);
+  }
+}
+
+/* sinh and cosh of x into h.re and h.im, the steps of gsl/math/sincos.h as
+ * loops: the elements where e^|x| overflows (infinite x too) come out of
+ * the expm1 one with an infinite cosh, the last loop redoes them */
+template <typename T>
+void sinhcosh(const T *x, split_block<T> &h, std::size_t n) {
+  for (std::size_t i = 0; i < n; i++) {
+    GSL_MATH_COUNT_CALL(sinhcosh);
+    h.re[i] = real::expm1(real::fabs(x[i]));
+  }
+  for (std::size_t i = 0; i < n; i++) {
+    const T t = h.re[i];
+    const T u = t + 1;
+    h.re[i] = real::copysign((t + t / u) / 2, x[i]);
+    h.im[i] = (u + 1 / u) / 2;
+  }
+  for (std::size_t i = 0; i < n; i++) {
+    if (real::isinf(h.im[i])) {
+      GSL_MATH_COUNT_PATH(sinhcosh, overflow);
+      const T e = real::exp(real::fabs(x[i]) / 2);
+      const T r = e * (e / 2);
+      h.re[i] = real::copysign(r, x[i]);
+      h.im[i] = r;
+    }
+  }
+}
+
+template <typename T>
+void sin(const T *xr, const T *xi, T *yr, T *yi, std::size_t n) {
+  split_block<T> s, h;
+  sincos(xr, s, n);
+  sinhcosh(xi, h, n);
+  for (std::size_t i = 0; i < n; i++) {
+    yr[i] = s.re[i] * h.im[i];
+    yi[i] = s.im[i] * h.re[i];
+  }
+}
+
+template <typename T>
+void cos(const T *xr, const T *xi, T *yr, T *yi, std::size_t n) {
+  split_block<T> s, h;
+  sincos(xr, s, n);
+  sinhcosh(xi, h, n);
+  for (std::size_t i = 0; i < n; i++) {
+    yr[i] = s.im[i] * h.im[i];
+    yi[i] = -s.re[i] * h.re[i];
+  }
+}
+
+template <typename T>
+void tan(const T *xr, const T *xi, T *yr, T *yi, std::size_t n) {
+  split_block<T> s, h;
+  sincos(xr, s, n);
+  sinhcosh(xi, h, n);
+  for (std::size_t i = 0; i < n; i++) {
+    const T sc = s.re[i] * s.im[i];
+    const T c2 = s.im[i] * s.im[i];
+    if (real::fabs(xi[i]) < 1) {
+      const T d = c2 + h.re[i] * h.re[i];
+      yr[i] = sc / d;
+      yi[i] = h.re[i] * h.im[i] / d;
+    } else {
+      GSL_MATH_COUNT_PATH(tan, overflow);
+      const T c = 1 / h.re[i];
+      const T d = 1 + c2 * c * c;
+      yr[i] = sc * c * c / d;
+      yi[i] = h.im[i] / h.re[i] / d;
+    }
+  }
+}
+
+template <typename T>
+void sinh(const T *xr, const T *xi, T *yr, T *yi, std::size_t n) {
+  split_block<T> s, h;
+  sinhcosh(xr, h, n);
+  sincos(xi, s, n);
+  for (std::size_t i = 0; i < n; i++) {
+    yr[i] = h.re[i] * s.im[i];
+    yi[i] = h.im[i] * s.re[i];
+  }
+}
+
+template <typename T>
+void cosh(const T *xr, const T *xi, T *yr, T *yi, std::size_t n) {
+  split_block<T> s, h;
+  sinhcosh(xr, h, n);
+  sincos(xi, s, n);
+  for (std::size_t i = 0; i < n; i++) {
+    yr[i] = h.im[i] * s.im[i];
+    yi[i] = h.re[i] * s.re[i];
+  }
+}
+
+template <typename T>
+void tanh(const T *xr, const T *xi, T *yr, T *yi, std::size_t n) {
+  split_block<T> s, h;
+  sinhcosh(xr, h, n);
+  sincos(xi, s, n);
+  for (std::size_t i = 0; i < n; i++) {
+    const T d = s.im[i] * s.im[i] + h.re[i] * h.re[i];
+    const T r = s.im[i] / h.re[i];
+    GSL_MATH_COUNT_PATH_IF(tanh, overflow, !(real::fabs(xr[i]) < 1));
+    yr[i] = real::fabs(xr[i]) < 1 ? h.re[i] * h.im[i] / d
+                                 : h.im[i] / h.re[i] / (1 + r * r);
+    yi[i] = s.re[i] * s.im[i] / d;
+  }
+}
+
+template <typename T>
+void add(const T *ar, const T *ai, const T *br, const T *bi, T *yr, T *yi,
+         std::size_t n) {
+  for (std::size_t i = 0; i < n; i++) {
+    yr[i] = ar[i] + br[i];
+    yi[i] = ai[i] + bi[i];
+  }
+}
+
+template <typename T>
+void sub(const T *ar, const T *ai, const T *br, const T *bi, T *yr, T *yi,
+         std::size_t n) {
+  for (std::size_t i = 0; i < n; i++) {
+    yr[i] = ar[i] - br[i];
+    yi[i] = ai[i] - bi[i];
+  }
+}
+
+template <typename T>
+void mul(const T *ar, const T *ai, const T *br, const T *bi, T *yr, T *yi,
+         std::size_t n) {
+  for (std::size_t i = 0; i < n; i++) {
+    yr[i] = ar[i] * br[i] - ai[i] * bi[i];
+    yi[i] = ar[i] * bi[i] + ai[i] * br[i];
+  }
+}
+
+template <typename T>
+void div(const T *ar, const T *ai, const T *br, const T *bi, T *yr, T *yi,
+         std::size_t n) {
+  for (std::size_t i = 0; i < n; i++) {
+    const T d = 1 / (br[i] * br[i] + bi[i] * bi[i]);
+    const T cr = br[i] * d;
+    const T ci = -bi[i] * d;
+    yr[i] = ar[i] * cr - ai[i] * ci;
+    yi[i] = ar[i] * ci + ai[i] * cr;
+  }
+}
+
+template <typename T>
+void pow(const T *ar, const T *ai, const T *br, const T *bi, T *yr, T *yi,
+         std::size_t n) {
+  abs(ar, ai, yr, n);
+  arg(ar, ai, yi, n);
+  for (std::size_t i = 0; i < n; i++) {
+    const T m = yr[i];
+    const T r = yi[i];
+    yr[i] = real::pow(m, br[i]) * real::exp(-r * bi[i]);
+    yi[i] = br[i] * r + bi[i] * real::log(m);
+  }
+  polar(yr, yi, n);
+}
+
+template <typename T>
+void add_real(const T *xr, const T *xi, T s, T *yr, T *yi, std::size_t n) {
+  for (std::size_t i = 0; i < n; i++) {
+    yr[i] = xr[i] + s;
+    yi[i] = xi[i];
+  }
+}
+
+template <typename T>
+void sub_real(const T *xr, const T *xi, T s, T *yr, T *yi, std::size_t n) {
+  add_real(xr, xi, -s, yr, yi, n);
+}
+
+template <typename T>
+void mul_real(const T *xr, const T *xi, T s, T *yr, T *yi, std::size_t n) {
+  for (std::size_t i = 0; i < n; i++) {
+    yr[i] = s * xr[i];
+    yi[i] = s * xi[i];
+  }
+}
+
+template <typename T>
+void div_real(const T *xr, const T *xi, T s, T *yr, T *yi, std::size_t n) {
+  mul_real(xr, xi, 1 / s, yr, yi, n);
+}
+
+template <typename T>
+void add_imag(const T *xr, const T *xi, T s, T *yr, T *yi, std::size_t n) {
+  for (std::size_t i = 0; i < n; i++) {
+    yr[i] = xr[i];
+    yi[i] = xi[i] + s;
+  }
+}
+
+template <typename T>
+void sub_imag(const T *xr, const T *xi, T s, T *yr, T *yi, std::size_t n) {
+  add_imag(xr, xi, -s, yr, yi, n);
+}
+
+template <typename T>
+void mul_imag(const T *xr, const T *xi, T s, T *yr, T *yi, std::size_t n) {
+  for (std::size_t i = 0; i < n; i++) {
+    yr[i] = -s * xi[i];
+    yi[i] = s * xr[i];
+  }
+}
+
+template <typename T>
+void div_imag(const T *xr, const T *xi, T s, T *yr, T *yi, std::size_t n) {
+  const T d = 1 / s;
+  for (std::size_t i = 0; i < n; i++) {
+    yr[i] = d * xi[i];
+    yi[i] = -d * xr[i];
+  }
+}
+
+template <typename T>
+void pow_real(const T *xr, const T *xi, T s, T *yr, T *yi, std::size_t n) {
+  abs(xr, xi, yr, n);
+  arg(xr, xi, yi, n);
+  for (std::size_t i = 0; i < n; i++) {
+    yr[i] = real::pow(yr[i], s);
+    yi[i] = s * yi[i];
+  }
+  polar(yr, yi, n);
+}
+
+/* Robust kernels, one loop per stage of gsl/math/robust.h: the prep and
+ * finish loops are selects and arithmetic, the libm loops make one call per
+ * element, a vector one where there is one */
+
+template <typename T>
+void robust_sqrt(const T *xr, const T *xi, T *yr, T *yi, std::size_t n) {
+  for (std::size_t i = 0; i < n; i++) {
+    robust::sqrt(xr[i], xi[i], yr[i], yi[i]);
+  }
+}
+
+template <typename T>
+void robust_logabs(const T *xr, const T *xi, T *y, std::size_t n) {
+  split_block<T> h;
+  for (std::size_t i = 0; i < n; i++) {
+    const auto a = robust::logabs_prep(xr[i], xi[i]);
+    h.re[i] = a.m;
+    h.im[i] = a.a;
+  }
+  for (std::size_t i = 0; i < n; i++) {
+    h.re[i] = real::log(h.re[i]);
+  }
+  for (std::size_t i = 0; i < n; i++) {
+    h.im[i] = real::log1p(h.im[i]);
+  }
+  for (std::size_t i = 0; i < n; i++) {
+    y[i] = h.re[i] + h.im[i] / 2;
+  }
+}
+
+template <typename T>
+void robust_div(const T *ar, const T *ai, const T *br, const T *bi, T *yr,
+                T *yi, std::size_t n) {
+  for (std::size_t i = 0; i < n; i++) {
+    robust::div(ar[i], ai[i], br[i], bi[i], yr[i], yi[i]);
+  }
+}
+
+/* arcsin, or arccos when Cos */
+template <typename T, bool Cos>
+void robust_hull(const T *xr, const T *xi, T *yr, T *yi, std::size_t n) {
+  split_block<T> p, l;
+  for (std::size_t i = 0; i < n; i++) {
+    const auto h = robust::hull_prep(xr[i], xi[i]);
+    p.re[i] = Cos ? h.den : h.num;
+    p.im[i] = Cos ? h.num : h.den;
+    l.re[i] = h.l;
+    l.im[i] = h.add;
+  }
+  for (std::size_t i = 0; i < n; i++) {
+    yr[i] = real::atan2(p.re[i], p.im[i]);
+  }
+  for (std::size_t i = 0; i < n; i++) {
+    yi[i] = real::log1p(l.re[i]);
+  }
+  for (std::size_t i = 0; i < n; i++) {
+    yi[i] = yi[i] + l.im[i];
+    if constexpr (Cos) {
+      robust::arccos_finish(xr[i], xi[i], yr[i], yi[i]);
+    } else {
+      robust::arcsin_finish(xr[i], xi[i], yr[i], yi[i]);
+    }
+  }
+}
+
+template <typename T>
+void robust_arcsin(const T *xr, const T *xi, T *yr, T *yi, std::size_t n) {
+  robust_hull<T, false>(xr, xi, yr, yi, n);
+}
+
+template <typename T>
+void robust_arccos(const T *xr, const T *xi, T *yr, T *yi, std::size_t n) {
+  robust_hull<T, true>(xr, xi, yr, yi, n);
+}
+
+template <typename T>
+void robust_arctan(const T *xr, const T *xi, T *yr, T *yi, std::size_t n) {
+  split_block<T> p, l;
+  for (std::size_t i = 0; i < n; i++) {
+    const auto h = robust::arctan_prep(xr[i], xi[i]);
+    p.re[i] = h.num;
+    p.im[i] = h.den;
+    l.re[i] = h.v;
+    l.im[i] = h.k;
+  }
+  for (std::size_t i = 0; i < n; i++) {
+    yr[i] = real::atan2(p.re[i], p.im[i]);
+  }
+  for (std::size_t i = 0; i < n; i++) {
+    yi[i] = real::log1p(l.re[i]);
+  }
+  for (std::size_t i = 0; i < n; i++) {
+    robust::arctan_finish(xr[i], xi[i], l.im[i], yr[i], yi[i]);
+  }
+}
+
+/* the hyperbolic ones through i a, as in the robust tier */
+
+template <typename T>
+void robust_arcsinh(const T *xr, const T *xi, T *yr, T *yi, std::size_t n) {
+  /* -i arcsin(i a) */
+  split_block<T> w;
+  for (std::size_t i = 0; i < n; i++) {
+    w.re[i] = -xi[i];
+  }
+  robust_arcsin(w.re, xr, yi, yr, n);
+  for (std::size_t i = 0; i < n; i++) {
+    yi[i] = -yi[i];
+  }
+}
+
+template <typename T>
+void robust_arccosh(const T *xr, const T *xi, T *yr, T *yi, std::size_t n) {
+  /* +-i arccos(a), the sign keeps the real part positive */
+  robust_arccos(xr, xi, yr, yi, n);
+  for (std::size_t i = 0; i < n; i++) {
+    const T r = yr[i], m = yi[i];
+    yr[i] = m > 0 ? m : -m;
+    yi[i] = m > 0 ? -r : r;
+  }
+}
+
+template <typename T>
+void robust_arctanh(const T *xr, const T *xi, T *yr, T *yi, std::size_t n) {
+  /* -i arctan(i a) */
+  split_block<T> w;
+  for (std::size_t i = 0; i < n; i++) {
+    w.re[i] = -xi[i];
+  }
+  robust_arctan(w.re, xr, yi, yr, n);
+  for (std::size_t i = 0; i < n; i++) {
+    yi[i] = -yi[i];
+  }
+}
+
+}  // namespace batch
+
+#define GSL_MATH_BATCH_UNARY_SPLIT(name)                                  \
+  template <typename T>                                                   \
+  void name(std::span<const complex_base<T>> in,                          \
+            std::span<complex_base<T>> out) {                             \
+    GSL_MATH_COUNT_BATCH(name, std::min(in.size(), out.size()));          \
+    using C = compute_type<T>;                                            \
+    batch::call<T>(&dispatch::kernels<T>::name,                           \
+                   batch::unary<T, batch::name<C>>, batch::raw(in),       \
+                   batch::raw(out), std::min(in.size(), out.size()));     \
+  }                                                                       \
+  template <typename T>                                                   \
+  void name(std::span<complex_base<T>> inout) {                           \
+    name<T>(std::span<const complex_base<T>>{inout}, inout);              \
+  }
+
+#define GSL_MATH_BATCH_UNARY_MAP(name)                                    \
+  template <typename T>                                                   \
+  void name(std::span<const complex_base<T>> in,                          \
+            std::span<complex_base<T>> out) {                             \
+    GSL_MATH_COUNT_BATCH(name, std::min(in.size(), out.size()));          \
+    batch::map(in, out, [](const auto &z) {                               \
+      return name<compute_type<T>>(z);                                    \
+    });                                                                   \
+  }                                                                       \
+  template <typename T>                                                   \
+  void name(std::span<complex_base<T>> inout) {                           \
+    name<T>(std::span<const complex_base<T>>{inout}, inout);              \
+  }
+
+#define GSL_MATH_BATCH_TO_REAL(name)                                      \
+  template <typename T>                                                   \
+  void name(std::span<const complex_base<T>> in, std::span<T> out) {      \
+    GSL_MATH_COUNT_BATCH(name, std::min(in.size(), out.size()));          \
+    using C = compute_type<T>;                                            \
+    batch::call<T>(&dispatch::kernels<T>::name,                           \
+                   batch::to_real<T, batch::name<C>>, batch::raw(in),     \
+                   out.data(), std::min(in.size(), out.size()));          \
+  }
+
+#define GSL_MATH_BATCH_UNARY_ROBUST(name)                                 \
+  template <typename T>                                                   \
+  void name(std::span<const complex_base<T>> in,                          \
+            std::span<complex_base<T>> out, accuracy::robust_t) {         \
+    GSL_MATH_COUNT_BATCH(name, std::min(in.size(), out.size()));          \
+    using C = compute_type<T>;                                            \
+    batch::call<T>(&dispatch::kernels<T>::robust_##name,                  \
+                   batch::unary<T, batch::robust_##name<C>>,              \
+                   batch::raw(in), batch::raw(out),                       \
+                   std::min(in.size(), out.size()));                      \
+  }                                                                       \
+  template <typename T>                                                   \
+  void name(std::span<complex_base<T>> inout, accuracy::robust_t r) {     \
+    name<T>(std::span<const complex_base<T>>{inout}, inout, r);           \
+  }
+
+#define GSL_MATH_BATCH_FROM_REAL(name)                                    \
+  template <typename T>                                                   \
+  void name(std::span<const T> in, std::span<complex_base<T>> out) {      \
+    GSL_MATH_COUNT_BATCH(name, std::min(in.size(), out.size()));          \
+    batch::map(in, out,                                                   \
+               [](auto x) { return name<compute_type<T>>(x); });          \
+  }
+
+#define GSL_MATH_BATCH_BINARY_SPLIT(name)                                 \
+  template <typename T>                                                   \
+  void name(std::span<const complex_base<T>> a,                           \
+            std::span<const complex_base<T>> b,                           \
+            std::span<complex_base<T>> out) {                             \
+    GSL_MATH_COUNT_BATCH(name,                                            \
+                         std::min({a.size(), b.size(), out.size()}));     \
+    using C = compute_type<T>;                                            \
+    batch::call<T>(&dispatch::kernels<T>::name,                           \
+                   batch::binary<T, batch::name<C>>, batch::raw(a),       \
+                   batch::raw(b), batch::raw(out),                        \
+                   std::min({a.size(), b.size(), out.size()}));           \
+  }                                                                       \
+  template <typename T>                                                   \
+  void name(std::span<complex_base<T>> a,                                 \
+            std::span<const complex_base<T>> b) {                         \
+    name<T>(std::span<const complex_base<T>>{a}, b, a);                   \
+  }
+
+#define GSL_MATH_BATCH_WITH_REAL(name)                                    \
+  template <typename T>                                                   \
+  void name(std::span<const complex_base<T>> a, T s,                      \
+            std::span<complex_base<T>> out) {                             \
+    GSL_MATH_COUNT_BATCH(name, std::min(a.size(), out.size()));           \
+    using C = compute_type<T>;                                            \
+    batch::call<T>(&dispatch::kernels<T>::name,                           \
+                   batch::with_real<T, batch::name<C>>, batch::raw(a), s, \
+                   batch::raw(out), std::min(a.size(), out.size()));      \
+  }                                                                       \
+  template <typename T>                                                   \
+  void name(std::span<complex_base<T>> a, T s) {                          \
+    name<T>(std::span<const complex_base<T>>{a}, s, a);                   \
+  }
+
+/* Properties of complex numbers */
+
+GSL_MATH_BATCH_TO_REAL(arg)
+GSL_MATH_BATCH_TO_REAL(abs)
+GSL_MATH_BATCH_TO_REAL(abs2)
+GSL_MATH_BATCH_TO_REAL(logabs)
+
+template <typename T>
+void logabs(std::span<const complex_base<T>> in, std::span<T> out,
+            accuracy::robust_t) {
+  GSL_MATH_COUNT_BATCH(logabs, std::min(in.size(), out.size()));
+  using C = compute_type<T>;
+  batch::call<T>(&dispatch::kernels<T>::robust_logabs,
+                 batch::to_real<T, batch::robust_logabs<C>>, batch::raw(in),
+                 out.data(), std::min(in.size(), out.size()));
+}
+
+/* Polar form, see gsl/type/polar_complex.h */
+
+template <std::floating_point T>
+void to_polar(std::span<const complex_base<T>> in,
+              std::span<polar_complex<T>> out) {
+  const auto n = std::min(in.size(), out.size());
+  GSL_MATH_COUNT_BATCH(to_polar, n);
+  batch::call<T>(&dispatch::kernels<T>::to_polar,
+                 batch::unary<T, batch::to_polar<T>>, batch::raw(in),
+                 reinterpret_cast<T *>(out.data()), n);
+}
+
+template <std::floating_point T>
+void from_polar(std::span<const polar_complex<T>> in,
+                std::span<complex_base<T>> out) {
+  const auto n = std::min(in.size(), out.size());
+  GSL_MATH_COUNT_BATCH(from_polar, n);
+  batch::call<T>(&dispatch::kernels<T>::from_polar,
+                 batch::unary<T, batch::from_polar<T>>,
+                 reinterpret_cast<const T *>(in.data()), batch::raw(out), n);
+}
+
+/* Complex arithmetic operators */
+
+GSL_MATH_BATCH_BINARY_SPLIT(add)
+GSL_MATH_BATCH_BINARY_SPLIT(sub)
+GSL_MATH_BATCH_BINARY_SPLIT(mul)
+GSL_MATH_BATCH_BINARY_SPLIT(div)
+
+template <typename T>
+void div(std::span<const complex_base<T>> a,
+         std::span<const complex_base<T>> b, std::span<complex_base<T>> out,
+         accuracy::robust_t) {
+  GSL_MATH_COUNT_BATCH(div, std::min({a.size(), b.size(), out.size()}));
+  using C = compute_type<T>;
+  batch::call<T>(&dispatch::kernels<T>::robust_div,
+                 batch::binary<T, batch::robust_div<C>>, batch::raw(a),
+                 batch::raw(b), batch::raw(out),
+                 std::min({a.size(), b.size(), out.size()}));
+}
+
+template <typename T>
+void div(std::span<complex_base<T>> a, std::span<const complex_base<T>> b,
+         accuracy::robust_t r) {
+  div<T>(std::span<const complex_base<T>>{a}, b, a, r);
+}
+
+GSL_MATH_BATCH_WITH_REAL(add_real)
+GSL_MATH_BATCH_WITH_REAL(sub_real)
+GSL_MATH_BATCH_WITH_REAL(mul_real)
+GSL_MATH_BATCH_WITH_REAL(div_real)
+GSL_MATH_BATCH_WITH_REAL(add_imag)
+GSL_MATH_BATCH_WITH_REAL(sub_imag)
+GSL_MATH_BATCH_WITH_REAL(mul_imag)
+GSL_MATH_BATCH_WITH_REAL(div_imag)
+
+GSL_MATH_BATCH_UNARY_SPLIT(conjugate)
+GSL_MATH_BATCH_UNARY_SPLIT(inverse)
+GSL_MATH_BATCH_UNARY_SPLIT(negative)
+
+/* Elementary Complex Functions */
+
+GSL_MATH_BATCH_UNARY_SPLIT(sqrt)
+GSL_MATH_BATCH_UNARY_ROBUST(sqrt)
+
+template <typename T>
+void sqrt_real(std::span<const T> in, std::span<complex_base<T>> out) {
+  GSL_MATH_COUNT_BATCH(sqrt_real, std::min(in.size(), out.size()));
+  using C = compute_type<T>;
+  batch::call<T>(&dispatch::kernels<T>::sqrt_real,
+                 batch::from_real<T, batch::sqrt_real<C>>, in.data(),
+                 batch::raw(out), std::min(in.size(), out.size()));
+}
+
+GSL_MATH_BATCH_BINARY_SPLIT(pow)
+GSL_MATH_BATCH_WITH_REAL(pow_real)
+
+GSL_MATH_BATCH_UNARY_SPLIT(exp)
+GSL_MATH_BATCH_UNARY_SPLIT(log)
+GSL_MATH_BATCH_UNARY_SPLIT(log10)
+
+template <typename T>
+void log_b(std::span<const complex_base<T>> a,
+           std::span<const complex_base<T>> b,
+           std::span<complex_base<T>> out) {
+  GSL_MATH_COUNT_BATCH(log_b, std::min({a.size(), b.size(), out.size()}));
+  batch::map(a, b, out, [](const auto &x, const auto &y) {
+    return log_b<compute_type<T>>(x, y);
+  });
+}
+
+template <typename T>
+void log_b(std::span<complex_base<T>> a, std::span<const complex_base<T>> b) {
+  log_b<T>(std::span<const complex_base<T>>{a}, b, a);
+}
+
+/* Complex Trigonometric Functions */
+
+GSL_MATH_BATCH_UNARY_SPLIT(sin)
+GSL_MATH_BATCH_UNARY_SPLIT(cos)
+GSL_MATH_BATCH_UNARY_MAP(sec)
+GSL_MATH_BATCH_UNARY_MAP(csc)
+GSL_MATH_BATCH_UNARY_SPLIT(tan)
+GSL_MATH_BATCH_UNARY_MAP(cot)
+
+/* Inverse Complex Trigonometric Functions */
+
+GSL_MATH_BATCH_UNARY_MAP(arcsin)
+GSL_MATH_BATCH_UNARY_ROBUST(arcsin)
+GSL_MATH_BATCH_FROM_REAL(arcsin_real)
+GSL_MATH_BATCH_UNARY_MAP(arccos)
+GSL_MATH_BATCH_UNARY_ROBUST(arccos)
+GSL_MATH_BATCH_FROM_REAL(arccos_real)
+GSL_MATH_BATCH_UNARY_MAP(arcsec)
+GSL_MATH_BATCH_FROM_REAL(arcsec_real)
+GSL_MATH_BATCH_UNARY_MAP(arccsc)
+GSL_MATH_BATCH_FROM_REAL(arccsc_real)
+GSL_MATH_BATCH_UNARY_MAP(arctan)
+GSL_MATH_BATCH_UNARY_ROBUST(arctan)
+GSL_MATH_BATCH_UNARY_MAP(arccot)
+
+/* Complex Hyperbolic Functions */
+
+GSL_MATH_BATCH_UNARY_SPLIT(sinh)
+GSL_MATH_BATCH_UNARY_SPLIT(cosh)
+GSL_MATH_BATCH_UNARY_MAP(sech)
+GSL_MATH_BATCH_UNARY_MAP(csch)
+GSL_MATH_BATCH_UNARY_SPLIT(tanh)
+GSL_MATH_BATCH_UNARY_MAP(coth)
+
+/* Inverse Complex Hyperbolic Functions */
+
+GSL_MATH_BATCH_UNARY_MAP(arcsinh)
+GSL_MATH_BATCH_UNARY_ROBUST(arcsinh)
+GSL_MATH_BATCH_UNARY_MAP(arccosh)
+GSL_MATH_BATCH_UNARY_ROBUST(arccosh)
+GSL_MATH_BATCH_FROM_REAL(arccosh_real)
+GSL_MATH_BATCH_UNARY_MAP(arcsech)
+GSL_MATH_BATCH_UNARY_MAP(arccsch)
+GSL_MATH_BATCH_UNARY_MAP(arctanh)
+GSL_MATH_BATCH_UNARY_ROBUST(arctanh)
+GSL_MATH_BATCH_FROM_REAL(arctanh_real)
+GSL_MATH_BATCH_UNARY_MAP(arccoth)
+
+#undef GSL_MATH_BATCH_UNARY_SPLIT
+#undef GSL_MATH_BATCH_UNARY_MAP
+#undef GSL_MATH_BATCH_UNARY_ROBUST
+#undef GSL_MATH_BATCH_TO_REAL
+#undef GSL_MATH_BATCH_FROM_REAL
+#undef GSL_MATH_BATCH_BINARY_SPLIT
+#undef GSL_MATH_BATCH_WITH_REAL
+
+}  // namespace gsl::math
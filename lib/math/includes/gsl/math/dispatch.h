@@ -0,0 +1,148 @@
+#pragma once
+
+#include <gsl/math/half.h>
+#include <gsl/math/isa.h>
+
+#include <cstddef>
+
+namespace gsl::math::dispatch {
+
+/* Runtime selection of the batch complex kernels
+ *
+ * gsl-lib-math carries one build of every split batch kernel per
+ * instruction set for float and double. The CPU is inspected once (cpuid,
+ * through __builtin_cpu_supports), the best supported variant is bound on
+ * first use and every batch call of gsl/math/complex_batch.h goes through
+ * the bound table. long double has no vector units to target and always
+ * runs the generic kernels. float16 and bfloat16 run the float kernels
+ * between a widening load and a narrowing store, see
+ * gsl/math/complex_batch.h; the avx2 and avx512 variants convert float16
+ * with the F16C / AVX-512F instructions. */
+
+/* the best variant this CPU can run */
+isa detected();
+
+/* the variant currently bound */
+isa active();
+
+/* is the variant compiled in and supported by this CPU */
+bool supported(isa v);
+
+/* bind a variant, returns false (and keeps the current one) when it is not
+ * supported */
+bool select(isa v);
+
+/* Kernel lists, X(name) for each function with a split kernel */
+
+#define GSL_MATH_BATCH_UNARY_KERNELS(X) \
+  X(conjugate)                          \
+  X(inverse)                            \
+  X(negative)                           \
+  X(sqrt)                               \
+  X(exp)                                \
+  X(log)                                \
+  X(log10)                              \
+  X(sin)                                \
+  X(cos)                                \
+  X(tan)                                \
+  X(sinh)                               \
+  X(cosh)                               \
+  X(tanh)                               \
+  X(to_polar)                           \
+  X(from_polar)                         \
+  X(robust_sqrt)                        \
+  X(robust_arcsin)                      \
+  X(robust_arccos)                      \
+  X(robust_arctan)                      \
+  X(robust_arcsinh)                     \
+  X(robust_arccosh)                     \
+  X(robust_arctanh)
+
+#define GSL_MATH_BATCH_TO_REAL_KERNELS(X) \
+  X(arg)                                  \
+  X(abs)                                  \
+  X(abs2)                                 \
+  X(logabs)                               \
+  X(robust_logabs)
+
+#define GSL_MATH_BATCH_FROM_REAL_KERNELS(X) X(sqrt_real)
+
+#define GSL_MATH_BATCH_BINARY_KERNELS(X) \
+  X(add)                                 \
+  X(sub)                                 \
+  X(mul)                                 \
+  X(div)                                 \
+  X(pow)                                 \
+  X(robust_div)
+
+#define GSL_MATH_BATCH_WITH_REAL_KERNELS(X) \
+  X(add_real)                               \
+  X(sub_real)                               \
+  X(mul_real)                               \
+  X(div_real)                               \
+  X(add_imag)                               \
+  X(sub_imag)                               \
+  X(mul_imag)                               \
+  X(div_imag)                               \
+  X(pow_real)
+
+/* one variant of the batch kernels, complex data is passed as interleaved
+ * (real, imag) pairs */
+template <typename T>
+struct kernels {
+  using unary_fn = void (*)(const T *in, T *out, std::size_t n);
+  using to_real_fn = void (*)(const T *in, T *out, std::size_t n);
+  using from_real_fn = void (*)(const T *in, T *out, std::size_t n);
+  using binary_fn = void (*)(const T *a, const T *b, T *out, std::size_t n);
+  using with_real_fn = void (*)(const T *a, T s, T *out, std::size_t n);
+
+  isa variant;
+
+#define GSL_MATH_BATCH_MEMBER(kind, name) kind##_fn name;
+#define GSL_MATH_BATCH_UNARY_MEMBER(name) GSL_MATH_BATCH_MEMBER(unary, name)
+#define GSL_MATH_BATCH_TO_REAL_MEMBER(name) GSL_MATH_BATCH_MEMBER(to_real, name)
+#define GSL_MATH_BATCH_FROM_REAL_MEMBER(name) \
+  GSL_MATH_BATCH_MEMBER(from_real, name)
+#define GSL_MATH_BATCH_BINARY_MEMBER(name) GSL_MATH_BATCH_MEMBER(binary, name)
+#define GSL_MATH_BATCH_WITH_REAL_MEMBER(name) \
+  GSL_MATH_BATCH_MEMBER(with_real, name)
+
+  GSL_MATH_BATCH_UNARY_KERNELS(GSL_MATH_BATCH_UNARY_MEMBER)
+  GSL_MATH_BATCH_TO_REAL_KERNELS(GSL_MATH_BATCH_TO_REAL_MEMBER)
+  GSL_MATH_BATCH_FROM_REAL_KERNELS(GSL_MATH_BATCH_FROM_REAL_MEMBER)
+  GSL_MATH_BATCH_BINARY_KERNELS(GSL_MATH_BATCH_BINARY_MEMBER)
+  GSL_MATH_BATCH_WITH_REAL_KERNELS(GSL_MATH_BATCH_WITH_REAL_MEMBER)
+
+#undef GSL_MATH_BATCH_MEMBER
+#undef GSL_MATH_BATCH_UNARY_MEMBER
+#undef GSL_MATH_BATCH_TO_REAL_MEMBER
+#undef GSL_MATH_BATCH_FROM_REAL_MEMBER
+#undef GSL_MATH_BATCH_BINARY_MEMBER
+#undef GSL_MATH_BATCH_WITH_REAL_MEMBER
+};
+
+template <typename T>
+constexpr bool is_dispatched = false;
+template <>
+constexpr bool is_dispatched<float> = true;
+template <>
+constexpr bool is_dispatched<double> = true;
+template <>
+constexpr bool is_dispatched<float16> = true;
+template <>
+constexpr bool is_dispatched<bfloat16> = true;
+
+/* the bound variant, only defined for the dispatched types */
+template <typename T>
+const kernels<T> &table();
+
+template <>
+const kernels<float> &table<float>();
+template <>
+const kernels<double> &table<double>();
+template <>
+const kernels<float16> &table<float16>();
+template <>
+const kernels<bfloat16> &table<bfloat16>();
+
+}  // namespace gsl::math::dispatch
@@ -0,0 +1,345 @@
+#pragma once
+
+#include <gsl/math/complex_batch.h>
+#include <gsl/math/double_double.h>
+#include <gsl/math/half.h>
+#include <gsl/math/instrument.h>
+#include <gsl/type/complex.h>
+#include <gsl/type/type_info.h>
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <span>
+
+namespace gsl::math {
+
+/* Reductions over spans of complex numbers
+ *
+ *   sum(in)        the sum of the elements
+ *   dot(a, b)      the sum of a[i] * b[i]
+ *   dotc(a, b)     the sum of conj(a[i]) * b[i]
+ *   prod(in)       the product of the elements
+ *   cumsum(in, out), cumprod(in, out)
+ *                  the running sums / products, also in place
+ *
+ * They read the input once, in the blocks of gsl/math/complex_batch.h
+ * (float16 and bfloat16 widened to float), keep the partial results in a
+ * more precise form and round to T only for what they return or store: a
+ * complex_float span is summed in double without a double copy of it.
+ *
+ * The precision is picked by the last argument:
+ *
+ *   accumulate::wide         (the default) in accumulate_type<T>, picked
+ *                            by type_info<complex_base<T>>::SHORT_REAL:
+ *                            double for float and the 16 bit types,
+ *                            double_double for double
+ *   accumulate::compensated  in T, with the rounding error of every add
+ *                            and multiply (two_sum, two_prod of
+ *                            gsl/math/double_double.h) carried in a
+ *                            second T: about twice the precision of T at
+ *                            the vector width of T, sum, dot, dotc and
+ *                            cumsum only, for the built-in types
+ *
+ * sum, dot, dotc and prod keep 8 independent partial results so that the
+ * loops vectorize; element i goes to partial result i % 8 and the partial
+ * results are combined in order at the end, the result does not depend on
+ * the instruction set. The running forms go element by element. */
+
+namespace accumulate {
+
+struct wide_t {};
+struct compensated_t {};
+
+inline constexpr wide_t wide{};
+inline constexpr compensated_t compensated{};
+
+template <typename A>
+concept policy = std::same_as<A, wide_t> || std::same_as<A, compensated_t>;
+
+}  // namespace accumulate
+
+/* the wide accumulation type, by the SHORT_REAL of type_info: the real
+ * scalar a complex_base<T> is stored in */
+template <typename T>
+struct accumulator {
+  using type = T;
+};
+template <>
+struct accumulator<float> {
+  using type = double;
+};
+template <>
+struct accumulator<float16> {
+  using type = double;
+};
+template <>
+struct accumulator<bfloat16> {
+  using type = double;
+};
+template <>
+struct accumulator<double> {
+  using type = double_double;
+};
+
+template <typename T>
+using accumulate_type = typename accumulator<
+    typename gsl::type::type_info<complex_base<T>>::SHORT_REAL>::type;
+
+namespace detail::reduce {
+
+constexpr std::size_t LANES = 8;
+
+/* the partial results of sum / dot in W */
+template <typename W>
+struct wide_sum {
+  W re[LANES]{};
+  W im[LANES]{};
+
+  template <typename C>
+  constexpr void add(std::size_t j, C r, C i) {
+    re[j] += W(r);
+    im[j] += W(i);
+  }
+
+  template <typename C>
+  constexpr void add_mul(std::size_t j, C ar, C ai, C br, C bi) {
+    const W xr = W(ar), xi = W(ai), yr = W(br), yi = W(bi);
+    re[j] += xr * yr - xi * yi;
+    im[j] += xr * yi + xi * yr;
+  }
+
+  template <typename T>
+  constexpr complex_base<T> total() const {
+    W r = re[0], i = im[0];
+    for (std::size_t j = 1; j < LANES; j++) {
+      r += re[j];
+      i += im[j];
+    }
+    return {static_cast<T>(r), static_cast<T>(i)};
+  }
+};
+
+/* the partial results of sum / dot in C, each with its error term */
+template <std::floating_point C>
+struct compensated_sum {
+  C re[LANES]{};
+  C im[LANES]{};
+  C re_err[LANES]{};
+  C im_err[LANES]{};
+
+  static constexpr void step(C &s, C &err, C x, C x_err) {
+    const auto [t, e] = gsl::math::detail::dd::two_sum(s, x);
+    s = t;
+    err += e + x_err;
+  }
+
+  constexpr void add(std::size_t j, C r, C i) {
+    step(re[j], re_err[j], r, 0);
+    step(im[j], im_err[j], i, 0);
+  }
+
+  constexpr void add_mul(std::size_t j, C ar, C ai, C br, C bi) {
+    using gsl::math::detail::dd::two_prod;
+    const auto rr = two_prod(ar, br);
+    step(re[j], re_err[j], rr[0], rr[1]);
+    const auto ii = two_prod(-ai, bi);
+    step(re[j], re_err[j], ii[0], ii[1]);
+    const auto ri = two_prod(ar, bi);
+    step(im[j], im_err[j], ri[0], ri[1]);
+    const auto ir = two_prod(ai, br);
+    step(im[j], im_err[j], ir[0], ir[1]);
+  }
+
+  template <typename T>
+  constexpr complex_base<T> total() const {
+    C r = 0, r_err = 0, i = 0, i_err = 0;
+    for (std::size_t j = 0; j < LANES; j++) {
+      step(r, r_err, re[j], re_err[j]);
+      step(i, i_err, im[j], im_err[j]);
+    }
+    return {static_cast<T>(r + r_err), static_cast<T>(i + i_err)};
+  }
+};
+
+/* the partial products in W */
+template <typename W>
+struct wide_prod {
+  W re[LANES];
+  W im[LANES];
+
+  constexpr wide_prod() {
+    for (std::size_t j = 0; j < LANES; j++) {
+      re[j] = 1;
+      im[j] = 0;
+    }
+  }
+
+  template <typename C>
+  constexpr void add(std::size_t j, C r, C i) {
+    const W yr = W(r), yi = W(i);
+    const W xr = re[j];
+    re[j] = xr * yr - im[j] * yi;
+    im[j] = xr * yi + im[j] * yr;
+  }
+
+  template <typename T>
+  constexpr complex_base<T> total() const {
+    W r = re[0], i = im[0];
+    for (std::size_t j = 1; j < LANES; j++) {
+      const W x = r;
+      r = x * re[j] - i * im[j];
+      i = x * im[j] + i * re[j];
+    }
+    return {static_cast<T>(r), static_cast<T>(i)};
+  }
+};
+
+template <typename T, typename A>
+using sum_type =
+    std::conditional_t<std::same_as<A, accumulate::wide_t>,
+                       wide_sum<accumulate_type<T>>,
+                       compensated_sum<compute_type<T>>>;
+
+/* f(lane, k) for k < m, k in lane k % LANES; unrolled by LANES so the
+ * lanes of f become vector lanes */
+template <typename F>
+constexpr void lanes(std::size_t m, F f) {
+  std::size_t k = 0;
+  for (; k + LANES <= m; k += LANES) {
+    for (std::size_t j = 0; j < LANES; j++) f(j, k + j);
+  }
+  for (std::size_t j = 0; k + j < m; j++) f(j, k + j);
+}
+
+template <typename T, typename Acc>
+void fold(Acc &acc, std::span<const complex_base<T>> in) {
+  batch::split_block<compute_type<T>> x;
+  for (std::size_t i = 0; i < in.size(); i += batch::BLOCK_SIZE) {
+    const auto m = batch::block_length(in.size(), i);
+    batch::load(x, batch::raw(in) + 2 * i, m);
+    lanes(m, [&](std::size_t j, std::size_t k) {
+      acc.add(j, x.re[k], x.im[k]);
+    });
+  }
+}
+
+template <bool Conjugate, typename T, typename Acc>
+void fold_mul(Acc &acc, std::span<const complex_base<T>> a,
+              std::span<const complex_base<T>> b) {
+  const auto n = std::min(a.size(), b.size());
+  batch::split_block<compute_type<T>> x, y;
+  for (std::size_t i = 0; i < n; i += batch::BLOCK_SIZE) {
+    const auto m = batch::block_length(n, i);
+    batch::load(x, batch::raw(a) + 2 * i, m);
+    batch::load(y, batch::raw(b) + 2 * i, m);
+    lanes(m, [&](std::size_t j, std::size_t k) {
+      acc.add_mul(j, x.re[k], Conjugate ? -x.im[k] : x.im[k], y.re[k],
+                  y.im[k]);
+    });
+  }
+}
+
+/* out[i] = step(in[i]), the running value in the compute type */
+template <typename T, typename Step>
+void scan(std::span<const complex_base<T>> in, std::span<complex_base<T>> out,
+          Step step) {
+  const auto n = std::min(in.size(), out.size());
+  batch::split_block<compute_type<T>> x;
+  for (std::size_t i = 0; i < n; i += batch::BLOCK_SIZE) {
+    const auto m = batch::block_length(n, i);
+    batch::load(x, batch::raw(in) + 2 * i, m);
+    for (std::size_t k = 0; k < m; k++) step(x.re[k], x.im[k]);
+    batch::store(x, batch::raw(out) + 2 * i, m);
+  }
+}
+
+}  // namespace detail::reduce
+
+template <typename T, accumulate::policy A = accumulate::wide_t>
+complex_base<T> sum(std::span<const complex_base<T>> in, A = {}) {
+  GSL_MATH_COUNT_BATCH(sum, in.size());
+  detail::reduce::sum_type<T, A> acc;
+  detail::reduce::fold(acc, in);
+  return acc.template total<T>();
+} /* return in[0] + in[1] + ... */
+
+template <typename T, accumulate::policy A = accumulate::wide_t>
+complex_base<T> dot(std::span<const complex_base<T>> a,
+                    std::span<const complex_base<T>> b, A = {}) {
+  GSL_MATH_COUNT_BATCH(dot, std::min(a.size(), b.size()));
+  detail::reduce::sum_type<T, A> acc;
+  detail::reduce::fold_mul<false>(acc, a, b);
+  return acc.template total<T>();
+} /* return a[0] b[0] + a[1] b[1] + ... */
+
+template <typename T, accumulate::policy A = accumulate::wide_t>
+complex_base<T> dotc(std::span<const complex_base<T>> a,
+                     std::span<const complex_base<T>> b, A = {}) {
+  GSL_MATH_COUNT_BATCH(dotc, std::min(a.size(), b.size()));
+  detail::reduce::sum_type<T, A> acc;
+  detail::reduce::fold_mul<true>(acc, a, b);
+  return acc.template total<T>();
+} /* return conj(a[0]) b[0] + conj(a[1]) b[1] + ... */
+
+template <typename T>
+complex_base<T> prod(std::span<const complex_base<T>> in,
+                     accumulate::wide_t = {}) {
+  GSL_MATH_COUNT_BATCH(prod, in.size());
+  detail::reduce::wide_prod<accumulate_type<T>> acc;
+  detail::reduce::fold(acc, in);
+  return acc.template total<T>();
+} /* return in[0] in[1] ... */
+
+template <typename T, accumulate::policy A = accumulate::wide_t>
+void cumsum(std::span<const complex_base<T>> in,
+            std::span<complex_base<T>> out, A = {}) {
+  GSL_MATH_COUNT_BATCH(cumsum, std::min(in.size(), out.size()));
+  using C = compute_type<T>;
+  if constexpr (std::same_as<A, accumulate::wide_t>) {
+    using W = accumulate_type<T>;
+    W r = 0, i = 0;
+    detail::reduce::scan(in, out, [&](C &x, C &y) {
+      r += W(x);
+      i += W(y);
+      x = static_cast<C>(r);
+      y = static_cast<C>(i);
+    });
+  } else {
+    C r = 0, r_err = 0, i = 0, i_err = 0;
+    detail::reduce::scan(in, out, [&](C &x, C &y) {
+      detail::reduce::compensated_sum<C>::step(r, r_err, x, 0);
+      detail::reduce::compensated_sum<C>::step(i, i_err, y, 0);
+      x = r + r_err;
+      y = i + i_err;
+    });
+  }
+} /* out[k] = in[0] + ... + in[k] */
+
+template <typename T, accumulate::policy A = accumulate::wide_t>
+void cumsum(std::span<complex_base<T>> inout, A a = {}) {
+  cumsum<T>(std::span<const complex_base<T>>{inout}, inout, a);
+}
+
+template <typename T>
+void cumprod(std::span<const complex_base<T>> in,
+             std::span<complex_base<T>> out, accumulate::wide_t = {}) {
+  GSL_MATH_COUNT_BATCH(cumprod, std::min(in.size(), out.size()));
+  using C = compute_type<T>;
+  using W = accumulate_type<T>;
+  W r = 1, i = 0;
+  detail::reduce::scan(in, out, [&](C &x, C &y) {
+    const W yr = W(x), yi = W(y), xr = r;
+    r = xr * yr - i * yi;
+    i = xr * yi + i * yr;
+    x = static_cast<C>(r);
+    y = static_cast<C>(i);
+  });
+} /* out[k] = in[0] ... in[k] */
+
+template <typename T>
+void cumprod(std::span<complex_base<T>> inout, accumulate::wide_t w = {}) {
+  cumprod<T>(std::span<const complex_base<T>>{inout}, inout, w);
+}
+
+}  // namespace gsl::math
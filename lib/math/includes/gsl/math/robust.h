@@ -0,0 +1,262 @@
+#pragma once
+
+#include <gsl/constant/machine.h>
+#include <gsl/math/instrument.h>
+#include <gsl/math/real.h>
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <limits>
+
+namespace gsl::math::robust {
+/* Branch-light stages of the robust complex algorithms
+ *
+ * The algorithms of Hull, Fairgrieve and Tang (see src/complex.cpp) pick a
+ * formula per region of the plane. Here the formula of every region is
+ * evaluated and the result is picked with a select, and each function is
+ * cut in stages:
+ *
+ *   prep    arithmetic, sqrt and selects only, vectorizes
+ *   libm    one call of one function per value (atan2, log, log1p)
+ *   finish  arithmetic and selects that put the parts together
+ *
+ * The robust tier of gsl/math/accuracy.h runs the stages on one value, the
+ * batch kernels of gsl/math/complex_batch.h run each stage as a loop over a
+ * block, so both give the same results. Values of the regions that are not
+ * picked may be inf or nan, they are discarded by the select. The selects
+ * are not nested and only pick values computed before them, so that they
+ * compile to blends. The GSL_MATH_COUNT_* hooks add branches, they are only
+ * there in instrumented builds (gsl/math/instrument.h). */
+
+/* The thresholds of the stages: gsl::constant::machine::machine<T> for the
+ * built-in types, so a float kernel tests float bounds. double_double is no
+ * IEEE format, it has the epsilon and max of its numeric_limits and powers
+ * of two on the safe side for the roots */
+template <floating_scalar T>
+struct machine : gsl::constant::machine::machine<T> {};
+
+template <>
+struct machine<double_double> {
+  static constexpr double_double EPSILON =
+      std::numeric_limits<double_double>::epsilon();
+  static constexpr double_double MAX =
+      std::numeric_limits<double_double>::max();
+  static constexpr double_double SQRT_MIN = 0x1p-484;
+  static constexpr double_double SQRT_MAX = 0x1p+511;
+};
+
+/* 2^e, exact */
+template <floating_scalar T>
+constexpr T pow2(int e) {
+  T r = 1;
+  for (; e > 0; e--) r *= 2;
+  for (; e < 0; e++) r /= 2;
+  return r;
+}
+
+/* sqrt(a^2 + b^2) without overflow or underflow of the squares: parts
+ * outside [lo, hi] are scaled by exact powers of two */
+template <floating_scalar T>
+constexpr T hypot(T a, T b) {
+  constexpr T hi = machine<T>::SQRT_MAX / 256, lo = machine<T>::SQRT_MIN * 128;
+  constexpr int e = std::numeric_limits<T>::max_exponent / 2;
+  constexpr T down = pow2<T>(-e), up = pow2<T>(e);
+
+  a = real::fabs(a);
+  b = real::fabs(b);
+  const T m = std::max(a, b);
+  const bool big = m > hi, small = m < lo;
+  GSL_MATH_COUNT_PATH_IF(hypot, overflow, big);
+  GSL_MATH_COUNT_PATH_IF(hypot, underflow, small);
+  T s = big ? down : T{1};
+  s = small ? up : s;
+  const T as = a * s, bs = b * s;
+  return real::sqrt(as * as + bs * bs) / s;
+}
+
+/* Elementary functions */
+
+template <floating_scalar T>
+constexpr void sqrt(T xr, T xi, T &yr, T &yi) {
+  const T x = real::fabs(xr), y = real::fabs(xi);
+  const T m = std::max(x, y), t = std::min(x, y) / m;
+  const T q = real::sqrt(1 + t * t);
+  const T w = real::sqrt(m) * real::sqrt(((x >= y ? T{1} : t) + q) / 2);
+
+  const T vi = xi >= 0 ? w : -w;
+  const T ur = xi / (2 * vi), ui = xi / (2 * w);
+  const bool zero = m == 0, right = xr >= 0;
+  GSL_MATH_COUNT_PATH_IF(sqrt, special_case, zero);
+  yr = right ? w : ur;
+  yi = right ? ui : vi;
+  yr = zero ? 0 : yr;
+  yi = zero ? 0 : yi;
+}
+
+/* log|z| = log(m) + log1p(a) / 2 */
+template <floating_scalar T>
+struct logabs_args {
+  T m;
+  T a;
+};
+
+template <floating_scalar T>
+constexpr logabs_args<T> logabs_prep(T xr, T xi) {
+  const T x = real::fabs(xr), y = real::fabs(xi);
+  const T max = std::max(x, y), min = std::min(x, y);
+  const T u = min / max;
+  const T u2 = u * u;
+  const T d = (max - 1) * (max + 1) + min * min;
+
+  /* log(max) cancels when |z| is close to 1 */
+  const bool near_one = (max > T{0.5}) & (max < T{2});
+  const bool edge = (max == 0) | (max > machine<T>::MAX);
+  GSL_MATH_COUNT_PATH_IF(logabs, special_case, edge);
+
+  T a = near_one ? d : u2;
+  a = edge ? T{0} : a;
+  return {near_one ? T{1} : max, a};
+}
+
+/* Complex arithmetic operators */
+
+/* Smith's algorithm, divide by the larger part of b */
+template <floating_scalar T>
+constexpr void div(T ar, T ai, T br, T bi, T &yr, T &yi) {
+  const bool by_re = real::fabs(br) >= real::fabs(bi);
+  /* b = s (c + i) or s (1 + i c), with c = t / s */
+  const T s = by_re ? br : bi, t = by_re ? bi : br;
+  const T c = t / s;
+  const T d = s + t * c;
+  const T p = by_re ? ar : ai, q = by_re ? ai : ar;
+  const T u = by_re ? ai : ar, v = by_re ? ar : ai;
+  yr = (p + q * c) / d;
+  const T w = (u - v * c) / d;
+  yi = by_re ? w : -w;
+}
+
+/* Inverse Complex Trigonometric Functions */
+
+/* arcsin and arccos of Hull et al. 1997, with x = |re z|, y = |im z| and
+ * their alpha = A and beta = B:
+ *
+ *   asin(B) = atan2(num, den), acos(B) = atan2(den, num)
+ *   acosh(A) = log1p(l) + add */
+template <floating_scalar T>
+struct hull_args {
+  T num;
+  T den;
+  T l;
+  T add;
+};
+
+template <floating_scalar T>
+constexpr hull_args<T> hull_prep(T R, T I) {
+  constexpr T A_crossover = 1.5, B_crossover = 0.6417;
+  constexpr T eps = machine<T>::EPSILON;
+
+  const T x = real::fabs(R), y = real::fabs(I);
+  const T r = hypot(x + 1, y);
+  const T s = hypot(x - 1, y);
+  const T A = r / 2 + s / 2;
+  const T B = x / A;
+  const T y2 = y * y;
+
+  /* real part: asin(B) directly while B is small, the atan forms of x / A
+   * near 1 */
+  const T Apx = A + x;
+  const T D1 = Apx * (y2 / (r + x + 1) + (s + (1 - x))) / 2;
+  const T D2 = (Apx / (r + x + 1) + Apx / (s + (x - 1))) / 2;
+  const T den_small = real::sqrt((1 - B) * (1 + B));
+  const T den_in = real::sqrt(D1), den_out = y * real::sqrt(D2);
+  const bool small_b = B <= B_crossover, inside = x <= 1;
+
+  /* imaginary part: A - 1 without the cancellation close to 1, A + sqrt(A^2
+   * - 1) == 2A once A^2 - 1 rounds to A^2, y / sqrt(1 - x^2) once y^2 is
+   * negligible next to 1 - x^2 (and may underflow) */
+  const T Am1_in = (y2 / (r + (x + 1)) + y2 / (s + (1 - x))) / 2;
+  const T Am1_out = (y2 / (r + (x + 1)) + (s + (x - 1))) / 2;
+  const T Am1 = x < 1 ? Am1_in : Am1_out;
+  const bool small_a = A <= A_crossover;
+  const T l_small = Am1 + real::sqrt(Am1 * (A + 1));
+  const T l_mid = (A - 1) + real::sqrt((A - 1) * (A + 1));
+  const T l_tiny = y / real::sqrt((1 - x) * (1 + x));
+  const T tiny_y = x < 1 ? eps * (1 - x) : T{0};
+  const bool tiny = y < tiny_y;
+  const bool huge = A >= 1 / eps;
+  GSL_MATH_COUNT_PATH_IF(hull, overflow, huge);
+  GSL_MATH_COUNT_PATH_IF(hull, underflow, tiny);
+
+  T den = inside ? den_in : den_out;
+  den = small_b ? den_small : den;
+  T l = small_a ? l_small : l_mid;
+  l = huge ? A : l;
+  l = tiny ? l_tiny : l;
+
+  return {small_b ? B : x, den, l, huge ? real::ln2<T> : T{0}};
+}
+
+/* the sign of the imaginary part of arcsin, on the real axis the cut for
+ * x > 1 is taken from below as in GSL */
+template <floating_scalar T>
+constexpr bool upper(T R, T I) {
+  return (I > 0) | ((I == 0) & (R <= 1));
+}
+
+/* on entry yr = atan2(num, den), yi = log1p(l) + add */
+template <floating_scalar T>
+constexpr void arcsin_finish(T R, T I, T &yr, T &yi) {
+  yr = R >= 0 ? yr : -yr;
+  yi = upper(R, I) ? yi : -yi;
+}
+
+/* on entry yr = atan2(den, num), yi = log1p(l) + add */
+template <floating_scalar T>
+constexpr void arccos_finish(T R, T I, T &yr, T &yi) {
+  const T c = real::pi<T> - yr;
+  yr = R >= 0 ? yr : c;
+  yi = upper(R, I) ? -yi : yi;
+}
+
+/* arctan(z) = atan2(num, den) / 2 + i k log1p(v) / 4 with
+ *   1 + v = |z + i|^2 / |z - i|^2 = 1 + 4 y / (x^2 + (y - 1)^2)
+ * for y = |im z| >= 0, which keeps log1p away from -1, and
+ *   den = 1 - |z|^2 = (1 - I) (1 + I) - R^2
+ * which does not cancel near +-i. Close to +-i, where 1 + v rounds to v and
+ * v may overflow, log(v) = 4 log(t) with t = sqrt(2 sqrt(y) / |z - i|). */
+template <floating_scalar T>
+struct arctan_args {
+  T num;
+  T den;
+  T v;
+  T k;
+};
+
+template <floating_scalar T>
+constexpr arctan_args<T> arctan_prep(T R, T I) {
+  constexpr T eps = machine<T>::EPSILON;
+
+  const T y = real::fabs(I);
+  const T d = R * R + (y - 1) * (y - 1);
+  const bool pole = d < 4 * y * eps;
+  GSL_MATH_COUNT_PATH_IF(arctan, special_case, pole);
+  const T t = real::sqrt(2 * real::sqrt(y)) / real::sqrt(hypot(R, y - 1));
+  const T v = 4 * y / d, w = t - 1;
+
+  return {2 * R, (1 - I) * (1 + I) - R * R, pole ? w : v, pole ? T{4} : T{1}};
+}
+
+/* on entry yr = atan2(num, den), yi = log1p(v) */
+template <floating_scalar T>
+constexpr void arctan_finish(T R, T I, T k, T &yr, T &yi) {
+  /* on the imaginary axis the cut is taken from the right for I > 1 and
+   * from the left for I < -1, as in GSL */
+  const bool cut = real::fabs(I) > 1;
+  const T axis = cut ? real::copysign(real::pi_2<T>, I) : T{0};
+  const T half = yr / 2;
+  yr = R == 0 ? axis : half;
+  yi = real::copysign(k * yi / 4, I);
+}
+
+}  // namespace gsl::math::robust
@@ -0,0 +1,359 @@
+/* Runtime selected variants of the batch complex kernels
+ *
+ * Every variant instantiates the same drivers of gsl/math/complex_batch.h.
+ * The ISA specific ones are wrapped in functions carrying a target attribute
+ * and flatten, so the whole driver and its kernel get inlined and compiled
+ * for that instruction set while the shared inline code stays untouched and
+ * safe to run on any CPU. float16 and bfloat16 use the float kernels, the
+ * variants differ in how they convert float16. */
+
+#include <gsl/math/complex_batch.h>
+#include <gsl/math/dispatch.h>
+
+#include <atomic>
+#include <cstddef>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define GSL_MATH_DISPATCH_X86_64 1
+#include <immintrin.h>
+#endif
+
+#if defined(GSL_MATH_LIBMVEC) && defined(GSL_MATH_DISPATCH_X86_64) && \
+    defined(__GLIBC__) && __GLIBC_PREREQ(2, 35)
+/* The libm functions the split kernels call, declared with their libmvec
+ * versions (_ZGVbN2v_exp, _ZGVdN4v_exp, _ZGVeN8v_exp, ...) so that every
+ * variant vectorizes its transcendental loops at its own width. glibc only
+ * declares them under -ffast-math, atan2, expm1 and log1p since 2.35. */
+#define GSL_MATH_SIMD __attribute__((simd("notinbranch")))
+extern "C" {
+double exp(double) noexcept GSL_MATH_SIMD;
+float expf(float) noexcept GSL_MATH_SIMD;
+double expm1(double) noexcept GSL_MATH_SIMD;
+float expm1f(float) noexcept GSL_MATH_SIMD;
+double log(double) noexcept GSL_MATH_SIMD;
+float logf(float) noexcept GSL_MATH_SIMD;
+double log1p(double) noexcept GSL_MATH_SIMD;
+float log1pf(float) noexcept GSL_MATH_SIMD;
+double pow(double, double) noexcept GSL_MATH_SIMD;
+float powf(float, float) noexcept GSL_MATH_SIMD;
+double sin(double) noexcept GSL_MATH_SIMD;
+float sinf(float) noexcept GSL_MATH_SIMD;
+double cos(double) noexcept GSL_MATH_SIMD;
+float cosf(float) noexcept GSL_MATH_SIMD;
+double atan2(double, double) noexcept GSL_MATH_SIMD;
+float atan2f(float, float) noexcept GSL_MATH_SIMD;
+}
+#undef GSL_MATH_SIMD
+#endif
+
+namespace gsl::math::dispatch {
+namespace {
+
+#ifdef GSL_MATH_DISPATCH_X86_64
+/* float16 <-> float with vcvtph2ps / vcvtps2ph, bfloat16 <-> float with a
+ * shift and the integer rounding of gsl/math/half.h, 8 or 16 at a time; the
+ * tail takes the generic loops, which give the same bits */
+struct f16c_convert : batch::convert {
+  using batch::convert::narrow;
+  using batch::convert::widen;
+
+  [[gnu::target("avx2,f16c")]] static void widen(const float16 *in,
+                                                  float *out, std::size_t n) {
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+      const auto h = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+      _mm256_storeu_ps(out + i, _mm256_cvtph_ps(h));
+    }
+    batch::convert::widen(in + i, out + i, n - i);
+  }
+
+  [[gnu::target("avx2,f16c")]] static void narrow(const float *in,
+                                                   float16 *out,
+                                                   std::size_t n) {
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+      const auto h =
+          _mm256_cvtps_ph(_mm256_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT);
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), h);
+    }
+    batch::convert::narrow(in + i, out + i, n - i);
+  }
+
+  [[gnu::target("avx2")]] static void widen(const bfloat16 *in, float *out,
+                                             std::size_t n) {
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+      const auto h = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+      const auto u = _mm256_slli_epi32(_mm256_cvtepu16_epi32(h), 16);
+      _mm256_storeu_ps(out + i, _mm256_castsi256_ps(u));
+    }
+    batch::convert::widen(in + i, out + i, n - i);
+  }
+
+  [[gnu::target("avx2")]] static void narrow(const float *in, bfloat16 *out,
+                                              std::size_t n) {
+    const auto one = _mm256_set1_epi32(1);
+    const auto half = _mm256_set1_epi32(0x7fff);
+    const auto quiet = _mm256_set1_epi32(0x40);
+    const auto abs = _mm256_set1_epi32(0x7fffffff);
+    const auto inf = _mm256_set1_epi32(0x7f800000);
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+      const auto u = _mm256_castps_si256(_mm256_loadu_ps(in + i));
+      const auto hi = _mm256_srli_epi32(u, 16);
+      const auto odd = _mm256_and_si256(hi, one);
+      const auto rounded = _mm256_srli_epi32(
+          _mm256_add_epi32(_mm256_add_epi32(u, half), odd), 16);
+      const auto nan = _mm256_cmpgt_epi32(_mm256_and_si256(u, abs), inf);
+      const auto r = _mm256_blendv_epi8(rounded, _mm256_or_si256(hi, quiet),
+                                        nan);
+      /* 32 -> 16 bits, packs works within the 128 bit lanes */
+      const auto p = _mm256_permute4x64_epi64(_mm256_packus_epi32(r, r), 0x08);
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i),
+                       _mm256_castsi256_si128(p));
+    }
+    batch::convert::narrow(in + i, out + i, n - i);
+  }
+};
+
+/* the maskz forms with every lane set: the unmasked ones start from
+ * _mm512_undefined_*, which GCC 12 reports as maybe uninitialized at -O3
+ * once per kernel they are inlined into */
+struct avx512_convert : batch::convert {
+  using batch::convert::narrow;
+  using batch::convert::widen;
+
+  static constexpr __mmask16 ALL = 0xffff;
+
+  [[gnu::target("avx512f")]] static void widen(const float16 *in, float *out,
+                                                std::size_t n) {
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+      const auto h =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + i));
+      _mm512_storeu_ps(out + i, _mm512_maskz_cvtph_ps(ALL, h));
+    }
+    batch::convert::widen(in + i, out + i, n - i);
+  }
+
+  [[gnu::target("avx512f")]] static void narrow(const float *in, float16 *out,
+                                                 std::size_t n) {
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+      const auto h =
+          _mm512_maskz_cvtps_ph(ALL, _mm512_loadu_ps(in + i),
+                                _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i), h);
+    }
+    batch::convert::narrow(in + i, out + i, n - i);
+  }
+
+  [[gnu::target("avx512f")]] static void widen(const bfloat16 *in, float *out,
+                                                std::size_t n) {
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+      const auto h =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + i));
+      const auto u = _mm512_maskz_slli_epi32(
+          ALL, _mm512_maskz_cvtepu16_epi32(ALL, h), 16);
+      _mm512_storeu_ps(out + i, _mm512_castsi512_ps(u));
+    }
+    batch::convert::widen(in + i, out + i, n - i);
+  }
+
+  [[gnu::target("avx512f")]] static void narrow(const float *in,
+                                                 bfloat16 *out,
+                                                 std::size_t n) {
+    const auto one = _mm512_set1_epi32(1);
+    const auto half = _mm512_set1_epi32(0x7fff);
+    const auto quiet = _mm512_set1_epi32(0x40);
+    const auto abs = _mm512_set1_epi32(0x7fffffff);
+    const auto inf = _mm512_set1_epi32(0x7f800000);
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+      const auto u = _mm512_castps_si512(_mm512_loadu_ps(in + i));
+      const auto hi = _mm512_maskz_srli_epi32(ALL, u, 16);
+      const auto odd = _mm512_and_si512(hi, one);
+      const auto rounded = _mm512_maskz_srli_epi32(
+          ALL, _mm512_add_epi32(_mm512_add_epi32(u, half), odd), 16);
+      const auto nan =
+          _mm512_cmpgt_epu32_mask(_mm512_and_si512(u, abs), inf);
+      const auto r =
+          _mm512_mask_blend_epi32(nan, rounded, _mm512_or_si512(hi, quiet));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i),
+                          _mm512_maskz_cvtepi32_epi16(ALL, r));
+    }
+    batch::convert::narrow(in + i, out + i, n - i);
+  }
+};
+#endif
+
+#define GSL_MATH_DISPATCH_VARIANT(variant, io, ...)                        \
+  struct variant {                                                         \
+    template <typename T, auto Kernel>                                     \
+    __VA_ARGS__ static void unary(const T *in, T *out, std::size_t n) {    \
+      batch::unary<T, Kernel, io>(in, out, n);                             \
+    }                                                                      \
+    template <typename T, auto Kernel>                                     \
+    __VA_ARGS__ static void to_real(const T *in, T *out, std::size_t n) {  \
+      batch::to_real<T, Kernel, io>(in, out, n);                           \
+    }                                                                      \
+    template <typename T, auto Kernel>                                     \
+    __VA_ARGS__ static void from_real(const T *in, T *out,                 \
+                                      std::size_t n) {                     \
+      batch::from_real<T, Kernel, io>(in, out, n);                         \
+    }                                                                      \
+    template <typename T, auto Kernel>                                     \
+    __VA_ARGS__ static void binary(const T *a, const T *b, T *out,         \
+                                   std::size_t n) {                        \
+      batch::binary<T, Kernel, io>(a, b, out, n);                          \
+    }                                                                      \
+    template <typename T, auto Kernel>                                     \
+    __VA_ARGS__ static void with_real(const T *a, T s, T *out,             \
+                                      std::size_t n) {                     \
+      batch::with_real<T, Kernel, io>(a, s, out, n);                       \
+    }                                                                      \
+  };
+
+GSL_MATH_DISPATCH_VARIANT(generic_variant, batch::convert)
+
+#ifdef GSL_MATH_DISPATCH_X86_64
+GSL_MATH_DISPATCH_VARIANT(avx2_variant, f16c_convert,
+                          [[gnu::target("avx2,fma,f16c"), gnu::flatten]])
+GSL_MATH_DISPATCH_VARIANT(
+    avx512_variant, avx512_convert,
+    [[gnu::target(
+          "avx512f,avx512dq,avx512vl,fma,f16c,prefer-vector-width=512"),
+      gnu::flatten]])
+#endif
+
+#undef GSL_MATH_DISPATCH_VARIANT
+
+template <typename Variant, typename T>
+constexpr kernels<T> make_table(isa v) {
+  kernels<T> k{};
+  k.variant = v;
+
+#define GSL_MATH_DISPATCH_ENTRY(kind, name) \
+  k.name = &Variant::template kind<T, batch::name<compute_type<T>>>;
+#define GSL_MATH_DISPATCH_UNARY(name) GSL_MATH_DISPATCH_ENTRY(unary, name)
+#define GSL_MATH_DISPATCH_TO_REAL(name) GSL_MATH_DISPATCH_ENTRY(to_real, name)
+#define GSL_MATH_DISPATCH_FROM_REAL(name) \
+  GSL_MATH_DISPATCH_ENTRY(from_real, name)
+#define GSL_MATH_DISPATCH_BINARY(name) GSL_MATH_DISPATCH_ENTRY(binary, name)
+#define GSL_MATH_DISPATCH_WITH_REAL(name) \
+  GSL_MATH_DISPATCH_ENTRY(with_real, name)
+
+  GSL_MATH_BATCH_UNARY_KERNELS(GSL_MATH_DISPATCH_UNARY)
+  GSL_MATH_BATCH_TO_REAL_KERNELS(GSL_MATH_DISPATCH_TO_REAL)
+  GSL_MATH_BATCH_FROM_REAL_KERNELS(GSL_MATH_DISPATCH_FROM_REAL)
+  GSL_MATH_BATCH_BINARY_KERNELS(GSL_MATH_DISPATCH_BINARY)
+  GSL_MATH_BATCH_WITH_REAL_KERNELS(GSL_MATH_DISPATCH_WITH_REAL)
+
+#undef GSL_MATH_DISPATCH_ENTRY
+#undef GSL_MATH_DISPATCH_UNARY
+#undef GSL_MATH_DISPATCH_TO_REAL
+#undef GSL_MATH_DISPATCH_FROM_REAL
+#undef GSL_MATH_DISPATCH_BINARY
+#undef GSL_MATH_DISPATCH_WITH_REAL
+
+  return k;
+}
+
+template <typename T>
+const kernels<T> &variant_table(isa v) {
+  static constexpr auto generic = make_table<generic_variant, T>(isa::generic);
+#ifdef GSL_MATH_DISPATCH_X86_64
+  static constexpr auto sse2 = make_table<generic_variant, T>(isa::sse2);
+  static constexpr auto avx2 = make_table<avx2_variant, T>(isa::avx2);
+  static constexpr auto avx512 = make_table<avx512_variant, T>(isa::avx512);
+
+  switch (v) {
+    case isa::sse2:
+      return sse2;
+    case isa::avx2:
+      return avx2;
+    case isa::avx512:
+      return avx512;
+    default:
+      return generic;
+  }
+#else
+  return generic;
+#endif
+}
+
+isa probe() {
+#ifdef GSL_MATH_DISPATCH_X86_64
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq") &&
+      __builtin_cpu_supports("avx512vl") && __builtin_cpu_supports("fma") &&
+      __builtin_cpu_supports("f16c")) {
+    return isa::avx512;
+  }
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") &&
+      __builtin_cpu_supports("f16c")) {
+    return isa::avx2;
+  }
+  return isa::sse2;
+#else
+  return isa::generic;
+#endif
+}
+
+std::atomic<isa> &bound() {
+  static std::atomic<isa> v{detected()};
+  return v;
+}
+
+}  // namespace
+
+isa detected() {
+  static const isa v = probe();
+  return v;
+}
+
+isa active() { return bound().load(std::memory_order_relaxed); }
+
+bool supported(isa v) {
+  const auto best = detected();
+  switch (v) {
+    case isa::generic:
+      return true;
+    case isa::sse2:
+      return best != isa::generic;
+    case isa::avx2:
+      return best == isa::avx2 || best == isa::avx512;
+    case isa::avx512:
+      return best == isa::avx512;
+  }
+  return false;
+}
+
+bool select(isa v) {
+  if (!supported(v)) return false;
+  bound().store(v, std::memory_order_relaxed);
+  return true;
+}
+
+template <>
+const kernels<float> &table<float>() {
+  return variant_table<float>(active());
+}
+
+template <>
+const kernels<double> &table<double>() {
+  return variant_table<double>(active());
+}
+
+template <>
+const kernels<float16> &table<float16>() {
+  return variant_table<float16>(active());
+}
+
+template <>
+const kernels<bfloat16> &table<bfloat16>() {
+  return variant_table<bfloat16>(active());
+}
+
+}  // namespace gsl::math::dispatch
@@ -0,0 +1,220 @@
+#include <gsl/constant/machine.h>
+#include <gsl/math/accuracy.h>
+#include <gsl/math/complex.h>
+#include <gsl/type/complex.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <string_view>
+#include <vector>
+
+#include "complex-data/results.h"
+#include "complex-data/results1.h"
+
+using gsl::type::complex;
+
+namespace accuracy = gsl::math::accuracy;
+
+namespace {
+
+using ref_type = std::complex<long double>;
+
+double rel_error(const complex &f, const complex &expected) {
+  if (f == expected) return 0;
+  const auto d =
+      std::hypot(f.real() - expected.real(), f.img() - expected.img());
+  return d / std::hypot(expected.real(), expected.img());
+}
+
+double rel_error(double f, double expected) {
+  if (f == expected) return 0;
+  return std::fabs(f - expected) / std::fabs(expected);
+}
+
+double rel_error(const complex &f, const ref_type &expected) {
+  return rel_error(f, complex{static_cast<double>(expected.real()),
+                              static_cast<double>(expected.imag())});
+}
+
+/* the tagged form of a function of complex-data/results*.h, nullptr when it
+ * has none */
+template <typename P>
+complex (*tagged(std::string_view name))(const complex &) {
+  if (name == "gsl::math::sqrt") {
+    return [](const complex &z) { return gsl::math::sqrt<double>(z, P{}); };
+  }
+  if (name == "gsl::math::log") {
+    return [](const complex &z) { return gsl::math::log<double>(z, P{}); };
+  }
+  if (name == "gsl::math::log10") {
+    return [](const complex &z) { return gsl::math::log10<double>(z, P{}); };
+  }
+  return nullptr;
+}
+
+template <typename P>
+double (*tagged_real(std::string_view name))(const complex &) {
+  if (name == "gsl::math::arg") {
+    return [](const complex &z) { return gsl::math::arg<double>(z, P{}); };
+  }
+  if (name == "gsl::math::abs") {
+    return [](const complex &z) { return gsl::math::abs<double>(z, P{}); };
+  }
+  if (name == "gsl::math::logabs") {
+    return [](const complex &z) { return gsl::math::logabs<double>(z, P{}); };
+  }
+  return nullptr;
+}
+
+/* well scaled points off the axes, the cuts of pow lie on them */
+std::vector<complex> scaled_grid() {
+  const double v[] = {-3.75, -1, -0.3, 0.125, 0.7, 1, 2.5};
+  std::vector<complex> r;
+  for (const auto x : v) {
+    for (const auto y : v) r.emplace_back(x, y);
+  }
+  return r;
+}
+
+template <typename P>
+void check_results() {
+  const auto bound = accuracy::bound<double, P>();
+
+  for (const auto &function_to_test : gsl::math::test::result::list) {
+    const auto f = tagged<P>(function_to_test.name);
+    if (!f) continue;
+    for (const auto &test : function_to_test.tests) {
+      EXPECT_LE(rel_error(f(test.arg), test.expected), bound)
+          << function_to_test.name << "(" << test.arg << ")";
+    }
+  }
+
+  for (const auto &function_to_test : gsl::math::test::result1::list) {
+    const auto f = tagged_real<P>(function_to_test.name);
+    if (!f) continue;
+    for (const auto &test : function_to_test.tests) {
+      EXPECT_LE(rel_error(f(test.arg), test.expected), bound)
+          << function_to_test.name << "(" << test.arg << ")";
+    }
+  }
+
+  /* inverse, div and pow have no table in complex-data */
+  const auto grid = scaled_grid();
+  for (const auto &a : grid) {
+    const ref_type ra{a.real(), a.img()};
+    EXPECT_LE(rel_error(gsl::math::inverse<double>(a, P{}), 1.0L / ra), bound)
+        << "inverse(" << a << ")";
+    for (const auto &b : grid) {
+      const ref_type rb{b.real(), b.img()};
+      EXPECT_LE(rel_error(gsl::math::div<double>(a, b, P{}), ra / rb), bound)
+          << "div(" << a << ", " << b << ")";
+      if (std::abs(rb * std::log(ra)) > 4) continue;
+      EXPECT_LE(rel_error(gsl::math::pow<double>(a, b, P{}), std::pow(ra, rb)),
+                bound)
+          << "pow(" << a << ", " << b << ")";
+    }
+  }
+}
+
+/* points near the branch points +-1, +-i and 0 and along the cuts */
+std::vector<complex> branch_grid() {
+  const double v[] = {0,    1e-300, 1e-20, 1.19209289550781250e-07,
+                      1e-3, 0.5,    0.99,  1 - 1e-12,
+                      1,    1 + 1e-12, 1.01, 2,
+                      10,   1e10,   1e200};
+  std::vector<complex> r;
+  for (const auto x : v) {
+    for (const auto y : v) {
+      r.emplace_back(x, y);
+      r.emplace_back(-x, y);
+      r.emplace_back(x, -y);
+      r.emplace_back(-x, -y);
+    }
+  }
+  return r;
+}
+
+/* the axes are left out, the cuts lie on them and GSL and C99 do not pick
+ * the same side */
+#define EXPECT_ROBUST(name, reference)                                    \
+  for (const auto &z : branch_grid()) {                                   \
+    if (z.real() == 0 || z.img() == 0) continue;                          \
+    const auto f = gsl::math::name<double>(z, accuracy::robust);          \
+    const auto e = reference(ref_type{z.real(), z.img()});                \
+    EXPECT_LE(rel_error(f, e), accuracy::bound<double>(accuracy::robust)) \
+        << #name << "(" << z << ") = " << f << " ?? " << e;               \
+  }
+
+}  // namespace
+
+TEST(GSLMathAccuracy, FastTest) { check_results<accuracy::fast_t>(); }
+
+TEST(GSLMathAccuracy, StandardTest) { check_results<accuracy::standard_t>(); }
+
+TEST(GSLMathAccuracy, RobustTest) { check_results<accuracy::robust_t>(); }
+
+TEST(GSLMathAccuracy, BoundTest) {
+  /* the epsilon of the element type, a float kernel is bounded in float */
+  using gsl::constant::machine::machine;
+  static_assert(accuracy::bound<float>(accuracy::robust) ==
+                8 * machine<float>::EPSILON);
+  static_assert(accuracy::bound<double>(accuracy::standard) ==
+                16 * machine<double>::EPSILON);
+  static_assert(accuracy::bound<gsl::math::double_double>(accuracy::fast) ==
+                64 * std::numeric_limits<gsl::math::double_double>::epsilon());
+}
+
+TEST(GSLMathAccuracy, FastMatchesUntaggedTest) {
+  for (const auto &z : branch_grid()) {
+    if (std::fabs(z.real()) > 1e100 || std::fabs(z.img()) > 1e100) continue;
+    EXPECT_EQ(gsl::math::abs<double>(z, accuracy::fast),
+              gsl::math::abs<double>(z));
+    EXPECT_EQ(gsl::math::sqrt<double>(z, accuracy::fast),
+              gsl::math::sqrt<double>(z));
+  }
+}
+
+TEST(GSLMathAccuracy, ScalingTest) {
+  const double big = 1e300, tiny = 1e-300;
+
+  for (const complex z : {complex{big, big}, complex{tiny, -tiny},
+                          complex{-big, tiny}, complex{tiny, big}}) {
+    const ref_type r{z.real(), z.img()};
+
+    for (const auto f : {gsl::math::abs<double>(z, accuracy::standard),
+                         gsl::math::abs<double>(z, accuracy::robust)}) {
+      EXPECT_LE(rel_error(f, static_cast<double>(std::abs(r))),
+                accuracy::bound<double>(accuracy::standard));
+    }
+    EXPECT_LE(rel_error(gsl::math::log<double>(z, accuracy::standard),
+                        std::log(r)),
+              accuracy::bound<double>(accuracy::standard));
+    EXPECT_LE(rel_error(gsl::math::sqrt<double>(z, accuracy::standard),
+                        std::sqrt(r)),
+              accuracy::bound<double>(accuracy::standard));
+    EXPECT_LE(rel_error(gsl::math::inverse<double>(z, accuracy::standard),
+                        1.0L / r),
+              accuracy::bound<double>(accuracy::standard));
+
+    const complex w{3, -4};
+    for (const auto f : {gsl::math::div<double>(w, z, accuracy::standard),
+                         gsl::math::div<double>(w, z, accuracy::robust)}) {
+      EXPECT_LE(rel_error(f, ref_type{3, -4} / r),
+                accuracy::bound<double>(accuracy::standard));
+    }
+  }
+
+  /* |z|^2 overflows in the fast tier */
+  EXPECT_TRUE(std::isinf(gsl::math::abs<double>({big, big}, accuracy::fast)));
+}
+
+TEST(GSLMathAccuracy, RobustInverseTest) {
+  EXPECT_ROBUST(arcsin, std::asin);
+  EXPECT_ROBUST(arccos, std::acos);
+  EXPECT_ROBUST(arctan, std::atan);
+  EXPECT_ROBUST(arcsinh, std::asinh);
+  EXPECT_ROBUST(arccosh, std::acosh);
+  EXPECT_ROBUST(arctanh, std::atanh);
+}
@@ -0,0 +1,266 @@
+#include <gsl/math/accuracy.h>
+#include <gsl/math/complex.h>
+#include <gsl/math/complex_batch.h>
+#include <gsl/type/complex.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using gsl::type::complex;
+using gsl::type::complex_base;
+using gsl::type::complex_float;
+
+namespace accuracy = gsl::math::accuracy;
+
+namespace {
+
+/* the regimes used in complex-data/results.h, with both signs */
+template <typename T>
+std::vector<complex_base<T>> grid() {
+  const T v[] = {0, 1.19209289550781250e-07, 5.0e-01, 1, 2, 3.14,
+                 8.3886080e+06};
+  std::vector<complex_base<T>> r;
+  for (const auto x : v) {
+    for (const auto y : v) {
+      r.emplace_back(x, y);
+      r.emplace_back(-x, y);
+      r.emplace_back(x, -y);
+      r.emplace_back(-x, -y);
+    }
+  }
+  /* more than one block */
+  const auto n = r.size();
+  for (size_t k = 0; k < 600; k++) {
+    r.push_back(r[k % n] * static_cast<T>(0.25));
+  }
+  return r;
+}
+
+template <typename T>
+bool near(T a, T b, T e) {
+  if (a == b || (std::isnan(a) && std::isnan(b))) return true;
+  if (std::isinf(a) || std::isinf(b)) return false;
+  const auto scale = std::max({std::abs(a), std::abs(b), T{1}});
+  return std::abs(a - b) <= e * scale;
+}
+
+template <typename T>
+bool near(const complex_base<T> &a, const complex_base<T> &b, T e) {
+  return near(a.real(), b.real(), e) && near(a.img(), b.img(), e);
+}
+
+/* past overflow the scalar and split forms may disagree between inf and nan
+ * (inf * 0), only finite results are compared */
+template <typename T>
+bool finite(const complex_base<T> &z) {
+  return std::isfinite(z.real()) && std::isfinite(z.img());
+}
+
+template <typename T>
+constexpr T eps() {
+  return std::is_same_v<T, float> ? 1e-5 : 1e-13;
+}
+
+#define EXPECT_BATCH_UNARY(T, name)                                  \
+  {                                                                  \
+    const auto in = grid<T>();                                       \
+    std::vector<complex_base<T>> out(in.size());                     \
+    gsl::math::name<T>(in, out);                                     \
+    for (size_t i = 0; i < in.size(); i++) {                         \
+      const auto expected = gsl::math::name<T>(in[i]);               \
+      if (!finite(expected)) continue;                               \
+      EXPECT_TRUE(near(out[i], expected, eps<T>()))                  \
+          << #name << "(" << in[i] << ") = " << out[i] << " ?? "     \
+          << expected;                                               \
+    }                                                                \
+    auto inout = in;                                                 \
+    gsl::math::name<T>(inout);                                       \
+    for (size_t i = 0; i < in.size(); i++) {                         \
+      EXPECT_TRUE(near(inout[i], out[i], T{0})) << #name << " inout"; \
+    }                                                                \
+  }
+
+#define EXPECT_BATCH_TO_REAL(T, name)                                \
+  {                                                                  \
+    const auto in = grid<T>();                                       \
+    std::vector<T> out(in.size());                                   \
+    gsl::math::name<T>(in, out);                                     \
+    for (size_t i = 0; i < in.size(); i++) {                         \
+      const T expected = gsl::math::name<T>(in[i]);                  \
+      EXPECT_TRUE(near(out[i], expected, eps<T>()))                  \
+          << #name << "(" << in[i] << ")";                           \
+    }                                                                \
+  }
+
+#define EXPECT_BATCH_BINARY(T, name)                                   \
+  {                                                                    \
+    const auto a = grid<T>();                                          \
+    std::vector<complex_base<T>> b(a.rbegin(), a.rend());              \
+    std::vector<complex_base<T>> out(a.size());                        \
+    gsl::math::name<T>(a, b, out);                                     \
+    for (size_t i = 0; i < a.size(); i++) {                            \
+      EXPECT_TRUE(near(out[i], gsl::math::name<T>(a[i], b[i]), eps<T>())) \
+          << #name << "(" << a[i] << ", " << b[i] << ")";              \
+    }                                                                  \
+  }
+
+#define EXPECT_BATCH_WITH_REAL(T, name, s)                            \
+  {                                                                   \
+    const auto a = grid<T>();                                         \
+    std::vector<complex_base<T>> out(a.size());                       \
+    gsl::math::name<T>(a, T{s}, out);                                 \
+    for (size_t i = 0; i < a.size(); i++) {                           \
+      EXPECT_TRUE(near(out[i], gsl::math::name<T>(a[i], T{s}), eps<T>())) \
+          << #name << "(" << a[i] << ", " << s << ")";                \
+    }                                                                 \
+  }
+
+/* the robust kernels against the robust tier */
+#define EXPECT_BATCH_ROBUST(T, name)                                      \
+  {                                                                       \
+    const auto in = grid<T>();                                            \
+    std::vector<complex_base<T>> out(in.size());                          \
+    gsl::math::name<T>(in, out, accuracy::robust);                        \
+    for (size_t i = 0; i < in.size(); i++) {                              \
+      const auto expected = gsl::math::name<T>(in[i], accuracy::robust);  \
+      EXPECT_TRUE(near(out[i], expected, eps<T>()))                       \
+          << #name << "(" << in[i] << ") = " << out[i] << " ?? "          \
+          << expected;                                                    \
+    }                                                                     \
+    auto inout = in;                                                      \
+    gsl::math::name<T>(inout, accuracy::robust);                          \
+    for (size_t i = 0; i < in.size(); i++) {                              \
+      EXPECT_TRUE(near(inout[i], out[i], T{0})) << #name << " inout";     \
+    }                                                                     \
+  }
+
+template <typename T>
+void check_robust() {
+  const auto in = grid<T>();
+  std::vector<complex_base<T>> b(in.rbegin(), in.rend());
+  std::vector<complex_base<T>> out(in.size());
+  std::vector<T> abs(in.size());
+
+  gsl::math::logabs<T>(in, abs, accuracy::robust);
+  gsl::math::div<T>(in, b, out, accuracy::robust);
+  for (size_t i = 0; i < in.size(); i++) {
+    EXPECT_TRUE(near(abs[i], gsl::math::logabs<T>(in[i], accuracy::robust),
+                     eps<T>()))
+        << "logabs(" << in[i] << ")";
+    EXPECT_TRUE(near(out[i], gsl::math::div<T>(in[i], b[i], accuracy::robust),
+                     eps<T>()))
+        << "div(" << in[i] << ", " << b[i] << ")";
+  }
+
+  EXPECT_BATCH_ROBUST(T, sqrt);
+  EXPECT_BATCH_ROBUST(T, arcsin);
+  EXPECT_BATCH_ROBUST(T, arccos);
+  EXPECT_BATCH_ROBUST(T, arctan);
+  EXPECT_BATCH_ROBUST(T, arcsinh);
+  EXPECT_BATCH_ROBUST(T, arccosh);
+  EXPECT_BATCH_ROBUST(T, arctanh);
+}
+
+template <typename T>
+void check_batch() {
+  EXPECT_BATCH_TO_REAL(T, arg);
+  EXPECT_BATCH_TO_REAL(T, abs);
+  EXPECT_BATCH_TO_REAL(T, abs2);
+  EXPECT_BATCH_TO_REAL(T, logabs);
+
+  EXPECT_BATCH_BINARY(T, add);
+  EXPECT_BATCH_BINARY(T, sub);
+  EXPECT_BATCH_BINARY(T, mul);
+  EXPECT_BATCH_BINARY(T, div);
+
+  EXPECT_BATCH_WITH_REAL(T, add_real, 2.5);
+  EXPECT_BATCH_WITH_REAL(T, sub_real, 2.5);
+  EXPECT_BATCH_WITH_REAL(T, mul_real, 2.5);
+  EXPECT_BATCH_WITH_REAL(T, div_real, 2.5);
+  EXPECT_BATCH_WITH_REAL(T, add_imag, 2.5);
+  EXPECT_BATCH_WITH_REAL(T, sub_imag, 2.5);
+  EXPECT_BATCH_WITH_REAL(T, mul_imag, 2.5);
+  EXPECT_BATCH_WITH_REAL(T, div_imag, 2.5);
+  EXPECT_BATCH_WITH_REAL(T, pow_real, 1.5);
+
+  EXPECT_BATCH_UNARY(T, conjugate);
+  EXPECT_BATCH_UNARY(T, inverse);
+  EXPECT_BATCH_UNARY(T, negative);
+  EXPECT_BATCH_UNARY(T, sqrt);
+  EXPECT_BATCH_UNARY(T, exp);
+  EXPECT_BATCH_UNARY(T, log);
+  EXPECT_BATCH_UNARY(T, log10);
+  EXPECT_BATCH_UNARY(T, sin);
+  EXPECT_BATCH_UNARY(T, cos);
+  EXPECT_BATCH_UNARY(T, tan);
+  EXPECT_BATCH_UNARY(T, sinh);
+  EXPECT_BATCH_UNARY(T, cosh);
+  EXPECT_BATCH_UNARY(T, tanh);
+  EXPECT_BATCH_UNARY(T, arcsin);
+  EXPECT_BATCH_UNARY(T, arctanh);
+
+  check_robust<T>();
+}
+
+}  // namespace
+
+TEST(GSLMathComplexBatch, DoubleTest) { check_batch<double>(); }
+
+TEST(GSLMathComplexBatch, FloatTest) { check_batch<float>(); }
+
+TEST(GSLMathComplexBatch, PowTest) {
+  const auto a = grid<double>();
+  const std::vector<complex> b(a.size(), complex{1.5, 0.25});
+  std::vector<complex> out(a.size());
+  gsl::math::pow<double>(a, b, out);
+  for (size_t i = 0; i < a.size(); i++) {
+    EXPECT_TRUE(near(out[i], gsl::math::pow<double>(a[i], b[i]), 1e-13));
+  }
+}
+
+TEST(GSLMathComplexBatch, SqrtRealTest) {
+  const std::vector<double> in{-10, -2, -1, -0.5, 0, 0.5, 1, 2, 10};
+  std::vector<complex> out(in.size());
+  gsl::math::sqrt_real<double>(in, out);
+  for (size_t i = 0; i < in.size(); i++) {
+    EXPECT_EQ(out[i], gsl::math::sqrt_real<double>(in[i]));
+  }
+}
+
+TEST(GSLMathComplexBatch, ShortOutputTest) {
+  const auto in = grid<double>();
+  std::vector<complex> out(3, complex{7, 7});
+  gsl::math::exp<double>(in, std::span{out}.first(2));
+  EXPECT_EQ(out[0], gsl::math::exp<double>(in[0]));
+  EXPECT_EQ(out[1], gsl::math::exp<double>(in[1]));
+  EXPECT_EQ(out[2], (complex{7, 7}));
+}
+
+TEST(GSLMathComplexBatch, DispatchTest) {
+  using gsl::math::dispatch::isa;
+  namespace dispatch = gsl::math::dispatch;
+
+  RecordProperty("detected_variant",
+                 std::string(dispatch::name(dispatch::detected())));
+  EXPECT_EQ(dispatch::active(), dispatch::detected());
+  EXPECT_TRUE(dispatch::supported(isa::generic));
+  EXPECT_TRUE(dispatch::supported(dispatch::detected()));
+
+  for (const auto v : {isa::generic, isa::sse2, isa::avx2, isa::avx512}) {
+    if (!dispatch::supported(v)) {
+      EXPECT_FALSE(dispatch::select(v));
+      continue;
+    }
+    EXPECT_TRUE(dispatch::select(v));
+    EXPECT_EQ(dispatch::active(), v);
+    EXPECT_EQ(dispatch::table<double>().variant, v);
+    EXPECT_EQ(dispatch::table<float>().variant, v);
+    check_batch<double>();
+    check_batch<float>();
+  }
+
+  dispatch::select(dispatch::detected());
+}
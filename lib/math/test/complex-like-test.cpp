@@ -0,0 +1,101 @@
+#include <gsl/math/accuracy.h>
+#include <gsl/math/complex.h>
+#include <gsl/type/complex.h>
+#include <gsl/type/complex_array.h>
+#include <gsl/type/complex_like.h>
+#include <gtest/gtest.h>
+
+#include <complex>
+#include <type_traits>
+
+using gsl::type::complex;
+using gsl::type::complex_array;
+using gsl::type::complex_base;
+using gsl::type::complex_float;
+using gsl::type::complex_like;
+
+namespace accuracy = gsl::math::accuracy;
+
+namespace {
+
+/* a type of another library, made complex_like by specializing the traits */
+struct iq {
+  float i;
+  float q;
+};
+
+}  // namespace
+
+template <>
+struct gsl::type::complex_traits<iq> {
+  using value_type = float;
+  using result_type = iq;
+
+  static constexpr float real(const iq& z) { return z.i; }
+  static constexpr float img(const iq& z) { return z.q; }
+  static constexpr iq make(float r, float i) { return {r, i}; }
+};
+
+static_assert(complex_like<complex> && complex_like<std::complex<float>>);
+static_assert(complex_like<complex_array<double>::reference> &&
+              complex_like<iq>);
+static_assert(!complex_like<double> && !complex_like<std::complex<int>>);
+
+TEST(GSLMathComplexLike, DeduceTest) {
+  const complex z{0.5, -1.25};
+  const std::complex<double> s{0.5, -1.25};
+
+  /* the deducing call is the explicit one */
+  EXPECT_EQ(gsl::math::sqrt(z), gsl::math::sqrt<double>(z));
+  EXPECT_EQ(gsl::math::arctanh(z), gsl::math::arctanh<double>(z));
+  EXPECT_EQ(gsl::math::arg(z), gsl::math::arg<double>(z));
+  EXPECT_EQ(gsl::math::pow_real(z, 3), gsl::math::pow_real<double>(z, 3));
+
+  /* std::complex in, std::complex out, the same values */
+  const auto r = gsl::math::sin(s);
+  static_assert(std::is_same_v<decltype(r), const std::complex<double>>);
+  const auto e = gsl::math::sin<double>(z);
+  EXPECT_EQ(r.real(), e.real());
+  EXPECT_EQ(r.imag(), e.img());
+  EXPECT_EQ(gsl::math::abs(s), gsl::math::abs<double>(z));
+
+  /* mixed arguments, the result in the type of the first */
+  const auto p = gsl::math::pow(s, z);
+  static_assert(std::is_same_v<decltype(p), const std::complex<double>>);
+  EXPECT_EQ(p.real(), gsl::math::pow<double>(z, z).real());
+  EXPECT_EQ(gsl::math::mul(z, s), z * z);
+
+  /* constant evaluation */
+  static_assert(gsl::math::exp(std::complex<double>{0, 0}) ==
+                std::complex<double>{1, 0});
+}
+
+TEST(GSLMathComplexLike, TaggedTest) {
+  const std::complex<float> s{-3e30F, 4e30F};
+  const complex_float z{-3e30F, 4e30F};
+
+  const auto r = gsl::math::sqrt(s, accuracy::robust);
+  static_assert(std::is_same_v<decltype(r), const std::complex<float>>);
+  EXPECT_EQ(r.real(), gsl::math::sqrt(z, accuracy::robust).real());
+  EXPECT_EQ(gsl::math::abs(s, accuracy::standard), 5e30F);
+  const auto q = gsl::math::div(s, z, accuracy::standard);
+  EXPECT_EQ(q.real(), gsl::math::div(z, z, accuracy::standard).real());
+}
+
+TEST(GSLMathComplexLike, ElementTest) {
+  complex_array<double> a(3);
+  a[1] = complex{-4, 0};
+
+  /* an element reads as its value and gives a complex_base */
+  const auto r = gsl::math::sqrt(a[1]);
+  static_assert(std::is_same_v<decltype(r), const complex>);
+  EXPECT_EQ(r, gsl::math::sqrt<double>(complex{-4, 0}));
+  a[2] = gsl::math::add(a[1], complex{1, 1});
+  EXPECT_EQ(a[2], (complex{-3, 1}));
+
+  /* and the specialized type round trips */
+  const auto q = gsl::math::conjugate(iq{1, 2});
+  static_assert(std::is_same_v<decltype(q), const iq>);
+  EXPECT_EQ(q.q, -2);
+  EXPECT_EQ(gsl::math::abs2(iq{3, 4}), 25);
+}
@@ -0,0 +1,165 @@
+#include <gsl/math/accuracy.h>
+#include <gsl/math/complex.h>
+#include <gsl/math/double_double.h>
+#include <gsl/math/real.h>
+#include <gsl/math/sincos.h>
+#include <gsl/type/complex.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+using gsl::math::double_double;
+using gsl::type::complex;
+
+namespace real = gsl::math::real;
+namespace accuracy = gsl::math::accuracy;
+
+namespace {
+
+constexpr std::array<double, 12> args = {
+    -20, -3.5, -1, -0.3, -1e-5, 0x1p-30, 0.25, 0.7, 1, 2.5, 10, 80};
+
+/* f of every argument, evaluated at compile time when called from a
+ * constant expression */
+template <typename T, typename F>
+constexpr auto table(F f) {
+  std::array<T, args.size()> r{};
+  for (std::size_t i = 0; i < args.size(); i++) {
+    r[i] = f(static_cast<T>(args[i]));
+  }
+  return r;
+}
+
+/* |a - b| in units of the epsilon of |b| */
+template <typename T>
+T ulps(T a, T b) {
+  if (a == b || (std::isnan(a) && std::isnan(b))) return 0;
+  const T scale = std::max(std::fabs(b), std::numeric_limits<T>::min());
+  return std::fabs(a - b) / (scale * std::numeric_limits<T>::epsilon());
+}
+
+template <typename T>
+void check_real() {
+  /* the compile time tables against libm */
+  constexpr auto exp = table<T>([](T x) { return real::exp(x); });
+  constexpr auto expm1 = table<T>([](T x) { return real::expm1(x); });
+  constexpr auto log = table<T>([](T x) { return real::log(x); });
+  constexpr auto log1p = table<T>([](T x) { return real::log1p(x); });
+  constexpr auto sqrt = table<T>([](T x) { return real::sqrt(x); });
+  constexpr auto sin = table<T>([](T x) { return real::sin(x); });
+  constexpr auto cos = table<T>([](T x) { return real::cos(x); });
+  constexpr auto atan2 =
+      table<T>([](T x) { return real::atan2(x, static_cast<T>(-0.75)); });
+  constexpr auto hypot =
+      table<T>([](T x) { return real::hypot(x, static_cast<T>(3)); });
+  constexpr auto pow =
+      table<T>([](T x) { return real::pow(static_cast<T>(1.5), x); });
+
+  for (std::size_t i = 0; i < args.size(); i++) {
+    const auto x = static_cast<T>(args[i]);
+    EXPECT_LE(ulps(exp[i], std::exp(x)), 1) << x;
+    EXPECT_LE(ulps(expm1[i], std::expm1(x)), 1) << x;
+    EXPECT_LE(ulps(sqrt[i], std::sqrt(x)), 1) << x;
+    EXPECT_LE(ulps(sin[i], std::sin(x)), 1) << x;
+    EXPECT_LE(ulps(cos[i], std::cos(x)), 1) << x;
+    EXPECT_LE(ulps(atan2[i], std::atan2(x, static_cast<T>(-0.75))), 1) << x;
+    EXPECT_LE(ulps(hypot[i], std::hypot(x, static_cast<T>(3))), 1) << x;
+    EXPECT_LE(ulps(pow[i], std::pow(static_cast<T>(1.5), x)), 1) << x;
+    if (x > -1) {
+      EXPECT_LE(ulps(log1p[i], std::log1p(x)), 1) << x;
+    }
+    if (x > 0) {
+      EXPECT_LE(ulps(log[i], std::log(x)), 1) << x;
+    }
+  }
+
+  /* the special values */
+  constexpr T inf = std::numeric_limits<T>::infinity();
+  static_assert(real::exp(T{0}) == 1 && real::exp(-inf) == 0);
+  static_assert(real::exp(inf) == inf && real::exp(T{1e5}) == inf);
+  static_assert(real::log(T{1}) == 0 && real::log(T{0}) == -inf);
+  static_assert(real::isnan(real::log(T{-1})));
+  static_assert(real::isnan(real::sqrt(T{-1})));
+  static_assert(real::sqrt(T{0}) == 0 && real::sqrt(T{4}) == 2);
+  constexpr auto pi = static_cast<T>(real::pi<double_double>);
+  static_assert(real::atan2(T{0}, T{-1}) == pi);
+  static_assert(real::atan2(-inf, inf) == -pi / 4);
+  static_assert(real::signbit(real::atan2(T{-0.0}, T{1})));
+  static_assert(real::pow(T{-2}, T{3}) == -8 && real::pow(T{0}, T{-1}) == inf);
+  static_assert(real::hypot(T{3}, T{4}) == 5);
+  static_assert(real::ldexp(T{1}, -3) == T{0.125});
+  static_assert(real::fmod(T{7.5}, T{-2}) == T{1.5});
+  static_assert(real::fmod(T{-0.0}, T{2}) == 0 &&
+                real::signbit(real::fmod(T{-0.0}, T{2})));
+  static_assert(real::isnan(real::fmod(inf, T{2})));
+  static_assert(real::copysign(T{2}, T{-0.0}) == -2);
+  static_assert(!real::isfinite(inf) && real::isinf(-inf));
+}
+
+}  // namespace
+
+TEST(GSLMathConstexpr, FloatTest) { check_real<float>(); }
+
+TEST(GSLMathConstexpr, DoubleTest) { check_real<double>(); }
+
+TEST(GSLMathConstexpr, LongDoubleTest) { check_real<long double>(); }
+
+TEST(GSLMathConstexpr, DoubleDoubleTest) {
+  /* the same values at compile time and at run time, to the last bits */
+  constexpr auto eps = std::numeric_limits<double_double>::epsilon();
+  constexpr double_double x{0.7};
+  constexpr double_double c[] = {real::exp(x),  real::log(x),
+                                 real::sin(x),  real::cos(x),
+                                 real::sqrt(x), real::atan2(x, -x / 3)};
+  const double_double r[] = {real::exp(x),  real::log(x),
+                             real::sin(x),  real::cos(x),
+                             real::sqrt(x), real::atan2(x, -x / 3)};
+  for (std::size_t i = 0; i < std::size(c); i++) {
+    EXPECT_LE(static_cast<double>(real::fabs(c[i] - r[i]) / real::fabs(r[i])),
+              4 * static_cast<double>(eps))
+        << i;
+  }
+}
+
+TEST(GSLMathConstexpr, ComplexTest) {
+  /* a table of twiddle factors, built by the compiler */
+  constexpr auto twiddles = [] {
+    std::array<complex, 16> t{};
+    for (std::size_t k = 0; k < t.size(); k++) {
+      t[k] = complex{complex::polar, 1,
+                     -2 * real::pi<double> * static_cast<double>(k) / 16};
+    }
+    return t;
+  }();
+  static_assert(twiddles[0] == complex::ONE);
+  static_assert(real::fabs(twiddles[4].real()) < 1e-16);
+  static_assert(twiddles[4].img() == -1);
+  for (std::size_t k = 0; k < twiddles.size(); k++) {
+    const double a = -2 * M_PI * static_cast<double>(k) / 16;
+    EXPECT_NEAR(twiddles[k].real(), std::cos(a), 1e-16) << k;
+    EXPECT_NEAR(twiddles[k].img(), std::sin(a), 1e-16) << k;
+  }
+
+  /* the elementary functions, against their run time values */
+  constexpr complex z{0.5, -1.25};
+  constexpr complex c[] = {
+      gsl::math::exp<double>(z),     gsl::math::log<double>(z),
+      gsl::math::sqrt<double>(z),    gsl::math::sin<double>(z),
+      gsl::math::tan<double>(z),     gsl::math::tanh<double>(z),
+      gsl::math::arcsin<double>(z),  gsl::math::pow<double>(z, z),
+      gsl::math::log<double>(z, accuracy::robust),
+      gsl::math::arctanh<double>(z, accuracy::robust)};
+  const complex r[] = {
+      gsl::math::exp<double>(z),     gsl::math::log<double>(z),
+      gsl::math::sqrt<double>(z),    gsl::math::sin<double>(z),
+      gsl::math::tan<double>(z),     gsl::math::tanh<double>(z),
+      gsl::math::arcsin<double>(z),  gsl::math::pow<double>(z, z),
+      gsl::math::log<double>(z, accuracy::robust),
+      gsl::math::arctanh<double>(z, accuracy::robust)};
+  for (std::size_t i = 0; i < std::size(c); i++) {
+    EXPECT_LE((c[i] - r[i]).dist(), 4e-16 * r[i].dist()) << i;
+  }
+}
@@ -0,0 +1,231 @@
+#include <gsl/math/accuracy.h>
+#include <gsl/math/complex.h>
+#include <gsl/math/complex_batch.h>
+#include <gsl/math/double_double.h>
+#include <gsl/math/real.h>
+#include <gsl/math/sincos.h>
+#include <gsl/type/complex.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <vector>
+
+using gsl::math::double_double;
+using gsl::type::complex_double_double;
+
+namespace real = gsl::math::real;
+namespace accuracy = gsl::math::accuracy;
+
+namespace {
+
+constexpr auto eps = std::numeric_limits<double_double>::epsilon();
+
+double rel_error(const double_double &f, const double_double &expected) {
+  if (f == expected) return 0;
+  return static_cast<double>(real::fabs(f - expected) /
+                             real::fabs(expected));
+}
+
+double rel_error(const complex_double_double &f,
+                 const complex_double_double &expected) {
+  return static_cast<double>((f - expected).dist() / expected.dist());
+}
+
+/* the values to 106 bits, rounded from 70 digit decimals */
+const double_double E{0x1.5bf0a8b145769p+1, 0x1.4d57ee2b1013ap-53};
+const double_double SQRT2{0x1.6a09e667f3bcdp+0, -0x1.bdd3413b26456p-54};
+const double_double THIRD{0x1.5555555555555p-2, 0x1.5555555555555p-56};
+
+}  // namespace
+
+TEST(GSLMathDoubleDouble, ArithmeticTest) {
+  /* the low part keeps what a double drops */
+  const double_double tiny = 0x1p-80;
+  EXPECT_EQ((1 + tiny) - 1, tiny);
+  EXPECT_EQ((double_double{1e16} + 1 - 1e16), 1);
+
+  EXPECT_LE(rel_error(double_double{1} / 3, THIRD), 1 * eps);
+  EXPECT_LE(rel_error(THIRD * 3, 1), 2 * eps);
+  EXPECT_LE(rel_error(SQRT2 * SQRT2, 2), 2 * eps);
+  EXPECT_LE(rel_error(real::sqrt(double_double{2}), SQRT2), eps);
+
+  EXPECT_LT(double_double{1}, 1 + tiny);
+  EXPECT_LT(-tiny, 0);
+  EXPECT_EQ(static_cast<double>(1 + tiny), 1.0);
+  EXPECT_EQ(double_double{2.5L}.hi(), 2.5);
+
+  /* exact at compile time */
+  constexpr double_double third = double_double{1} / 3;
+  static_assert(third * 3 - 1 < 4 * eps);
+}
+
+TEST(GSLMathDoubleDouble, SpecialValuesTest) {
+  constexpr auto inf = std::numeric_limits<double_double>::infinity();
+
+  EXPECT_TRUE(real::isinf(double_double{1e300} * 1e300));
+  EXPECT_EQ(double_double{1} / 0.0, inf);
+  EXPECT_EQ(double_double{1} / inf, 0);
+  EXPECT_TRUE(real::isnan(inf - inf));
+  EXPECT_TRUE(real::isnan(real::sqrt(double_double{-1})));
+  EXPECT_EQ(real::exp(inf), inf);
+  EXPECT_EQ(real::exp(-inf), 0);
+  EXPECT_EQ(real::log(double_double{0}), -inf);
+  EXPECT_EQ(real::hypot(inf, double_double{1}), inf);
+
+  /* the exact multiples of pi / 4 */
+  EXPECT_EQ(real::atan2(double_double{0}, double_double{-1}),
+            real::pi<double_double>);
+  EXPECT_EQ(real::atan2(double_double{1}, double_double{0}),
+            real::pi_2<double_double>);
+  EXPECT_TRUE(real::signbit(real::atan2(-double_double{0}, double_double{1})));
+}
+
+TEST(GSLMathDoubleDouble, ElementaryFunctionsTest) {
+  const double_double x = 0x1p-34;
+
+  const struct {
+    double_double f, expected;
+  } cases[] = {
+      {real::exp(double_double{1}), E},
+      {real::exp(double_double{-3.5}),
+       {0x1.eec1018e4ff66p-6, -0x1.2d4a15bf94b5bp-63}},
+      {real::exp(double_double{-20}),
+       {0x1.1b48655f37267p-29, -0x1.9fb4baeafe811p-85}},
+      {real::expm1(x), {0x1.0000000020000p-34, 0x1.555555556aaabp-105}},
+      {real::log(double_double{7}),
+       {0x1.f2272ae325a57p+0, 0x1.51bda525b3c98p-54}},
+      {real::log(E), 1},
+      {real::log1p(x), {0x1.ffffffffc0000p-35, 0x1.5555555515555p-104}},
+      {real::sin(double_double{1}),
+       {0x1.aed548f090ceep-1, 0x1.06374f484e288p-59}},
+      {real::cos(double_double{1}),
+       {0x1.14a280fb5068cp-1, -0x1.b71edcc9344bcp-55}},
+      {real::sin(double_double{100}),
+       {-0x1.03425b78c4db8p-1, -0x1.c23d8557420fbp-59}},
+      {real::cos(double_double{100}),
+       {0x1.b981dbf665fdfp-1, 0x1.8fd0cdcd985e8p-55}},
+      {real::atan2(double_double{2}, double_double{3}),
+       {0x1.2d0ead6066395p-1, 0x1.b488828b0522fp-55}},
+      {real::pow(double_double{3}, THIRD),
+       {0x1.7137449123ef6p+0, 0x1.73779fc5b15b9p-54}},
+      {real::pow(double_double{-2}, double_double{3}), -8},
+      {real::hypot(double_double{3e300}, double_double{4e300}), 5e300},
+  };
+
+  for (const auto &c : cases) {
+    EXPECT_LE(rel_error(c.f, c.expected), 8 * eps)
+        << std::setprecision(32) << c.f << " != " << c.expected;
+  }
+}
+
+TEST(GSLMathDoubleDouble, OutputTest) {
+  std::ostringstream out;
+  out << std::setprecision(32) << real::pi<double_double> << ' '
+      << -THIRD / 1e10 << ' ' << std::setprecision(6) << E * 1e20 << ' '
+      << double_double{0.5};
+  EXPECT_EQ(out.str(),
+            "3.1415926535897932384626433832795 "
+            "-3.3333333333333333333333333333333e-11 2.71828e+20 0.5");
+}
+
+TEST(GSLMathDoubleDouble, ComplexTest) {
+  using K = complex_double_double;
+  const K z{0.5, 2};
+
+  /* e^(i pi) = -1 and the round trips of the inverse functions, to about
+   * the precision of the type */
+  const auto m = gsl::math::exp<double_double>(
+      K{0, real::pi<double_double>});
+  EXPECT_LE(rel_error(m, K{-1, 0}), 4 * eps);
+  EXPECT_LE(rel_error(gsl::math::sin<double_double>(
+                          gsl::math::arcsin<double_double>(z)),
+                      z),
+            64 * eps);
+  EXPECT_LE(rel_error(gsl::math::tanh<double_double>(
+                          gsl::math::arctanh<double_double>(z)),
+                      z),
+            64 * eps);
+  EXPECT_LE(rel_error(gsl::math::mul<double_double>(
+                          gsl::math::sqrt<double_double>(z),
+                          gsl::math::sqrt<double_double>(z)),
+                      z),
+            16 * eps);
+
+  /* every tier */
+  const auto lf = gsl::math::log<double_double>(z, accuracy::fast);
+  const auto ls = gsl::math::log<double_double>(z, accuracy::standard);
+  const auto lr = gsl::math::log<double_double>(z, accuracy::robust);
+  EXPECT_LE(rel_error(lf, lr), 16 * eps);
+  EXPECT_LE(rel_error(ls, lr), 16 * eps);
+  const K big{0x3p+900, 0x4p+900};
+  EXPECT_LE(rel_error(gsl::math::sqrt<double_double>(big, accuracy::robust),
+                      K{0x2p+450, 0x1p+450}),
+            16 * eps);
+
+  const auto sc = gsl::math::sincos(double_double{1});
+  EXPECT_LE(rel_error(sc.sin * sc.sin + sc.cos * sc.cos, 1), 4 * eps);
+  const auto sh = gsl::math::sinhcosh(double_double{0.25});
+  EXPECT_LE(rel_error(sh.cosh * sh.cosh - sh.sinh * sh.sinh, 1), 8 * eps);
+}
+
+TEST(GSLMathDoubleDouble, ErrorFreeTest) {
+  /* the transformations of every floating point type are exact, at run
+   * time (with an fma when the target has one) and at compile time */
+  namespace dd = gsl::math::detail::dd;
+  const float a = 1.1F, b = -3.7e-3F;
+  const auto [p, e] = dd::two_prod(a, b);
+  EXPECT_EQ(static_cast<double>(p) + e,
+            static_cast<double>(a) * static_cast<double>(b));
+  const auto [s, t] = dd::two_sum(a, b);
+  EXPECT_EQ(static_cast<double>(s) + t,
+            static_cast<double>(a) + static_cast<double>(b));
+  const auto [hi, lo] = dd::split(3e38F);
+  EXPECT_EQ(hi + lo, 3e38F);
+  /* split scaled near overflow, the product fits a long double */
+  const double x = 0x1.fffffffffffffp+1000;
+  const auto big = dd::two_prod(x, 3.0);
+  EXPECT_EQ(static_cast<long double>(big[0]) + big[1],
+            static_cast<long double>(x) * 3);
+
+  constexpr auto q = dd::two_prod(1.0F / 3, 3.0F);
+  static_assert(q[0] == 1 && q[1] != 0);
+  static_assert(static_cast<double>(q[0]) + q[1] ==
+                static_cast<double>(1.0F / 3) * 3);
+}
+
+TEST(GSLMathDoubleDouble, AccumulationTest) {
+  /* small terms between cancelling large ones: in double 1e16 + 1 == 1e16
+   * and every small term is lost, double_double keeps them all */
+  using K = complex_double_double;
+  K sum;
+  gsl::type::complex sum_double;
+  for (int k = 0; k < 1000; k++) {
+    const double s = k % 2 ? 1e16 : -1e16;
+    sum = sum + K{s, 0} + K{1, 0.5};
+    sum_double = sum_double + gsl::type::complex{s, 0} +
+                 gsl::type::complex{1, 0.5};
+  }
+  EXPECT_EQ(sum, (K{1000, 500}));
+  EXPECT_NE(sum_double.real(), 1000);
+}
+
+TEST(GSLMathDoubleDouble, BatchTest) {
+  using K = complex_double_double;
+  std::vector<K> in, out(40);
+  for (int i = 0; i < 40; i++) in.push_back(K{0.1 * i - 2, 0.3 * i - 5});
+
+  gsl::math::exp<double_double>(in, out);
+  for (std::size_t i = 0; i < in.size(); i++) {
+    EXPECT_LE(rel_error(out[i], gsl::math::exp<double_double>(in[i])),
+              4 * eps);
+  }
+
+  gsl::math::arcsin<double_double>(in, out, accuracy::robust);
+  for (std::size_t i = 0; i < in.size(); i++) {
+    EXPECT_EQ(out[i], gsl::math::arcsin<double_double>(in[i],
+                                                        accuracy::robust));
+  }
+}
@@ -0,0 +1,206 @@
+#include <gsl/math/complex.h>
+#include <gsl/math/complex_batch.h>
+#include <gsl/math/dispatch.h>
+#include <gsl/math/half.h>
+#include <gsl/type/complex.h>
+#include <gtest/gtest.h>
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+using gsl::math::bfloat16;
+using gsl::math::float16;
+using gsl::type::complex_bfloat16;
+using gsl::type::complex_float;
+using gsl::type::complex_float16;
+
+namespace dispatch = gsl::math::dispatch;
+
+namespace {
+
+float bits_to_float(std::uint32_t u) { return std::bit_cast<float>(u); }
+
+/* exact in constant expressions */
+static_assert(static_cast<float>(float16{0.5F}) == 0.5F);
+static_assert(float16{65504.0F}.bits() == 0x7bff);
+static_assert(static_cast<float>(bfloat16{-2.0F}) == -2.0F);
+static_assert(complex_float16::ONE.real() == 1.0F);
+static_assert(sizeof(complex_float16) == 4 && sizeof(complex_bfloat16) == 4);
+
+/* every element of the batch, as stored bits */
+template <typename S>
+std::vector<gsl::type::complex_base<S>> samples() {
+  std::vector<gsl::type::complex_base<S>> r;
+  for (std::uint32_t k = 0; k < 1000; k++) {
+    /* a walk over the bit patterns, specials and subnormals included */
+    const auto re = static_cast<std::uint16_t>(k * 40503u);
+    const auto im = static_cast<std::uint16_t>(k * 12345u + 7u);
+    r.emplace_back(S::from_bits(re), S::from_bits(im));
+  }
+  return r;
+}
+
+bool same(float a, float b) {
+  return a == b || (std::isnan(a) && std::isnan(b));
+}
+
+template <typename S>
+bool same(const gsl::type::complex_base<S> &a,
+          const gsl::type::complex_base<S> &b) {
+  return same(a.real(), b.real()) && same(a.img(), b.img());
+}
+
+/* the float16 / bfloat16 batch gives the float batch of the widened input,
+ * rounded */
+template <typename S>
+void check_batch() {
+  const auto in = samples<S>();
+  std::vector<complex_float> wide;
+  for (const auto &z : in) wide.emplace_back(z);
+
+  std::vector<gsl::type::complex_base<S>> out(in.size());
+  std::vector<complex_float> expected(in.size());
+
+  /* exact, but a nan comes back quiet */
+  gsl::math::conjugate<S>(in, out);
+  for (std::size_t i = 0; i < in.size(); i++) {
+    EXPECT_TRUE(same(out[i].real(), in[i].real())) << i;
+    if (!std::isnan(static_cast<float>(in[i].real()))) {
+      EXPECT_EQ(out[i].real().bits(), in[i].real().bits()) << i;
+    }
+    if (!std::isnan(static_cast<float>(in[i].img()))) {
+      EXPECT_EQ(out[i].img().bits(), in[i].img().bits() ^ 0x8000u) << i;
+    }
+  }
+
+  gsl::math::mul<S>(in, in, out);
+  gsl::math::mul<float>(wide, wide, expected);
+  for (std::size_t i = 0; i < in.size(); i++) {
+    EXPECT_TRUE(same(out[i], gsl::type::complex_base<S>(expected[i]))) << i;
+  }
+
+  gsl::math::exp<S>(in, out);
+  gsl::math::exp<float>(wide, expected);
+  for (std::size_t i = 0; i < in.size(); i++) {
+    EXPECT_TRUE(same(out[i], gsl::type::complex_base<S>(expected[i]))) << i;
+  }
+
+  std::vector<S> abs(in.size());
+  std::vector<float> abs_expected(in.size());
+  gsl::math::abs<S>(in, abs);
+  gsl::math::abs<float>(wide, abs_expected);
+  for (std::size_t i = 0; i < in.size(); i++) {
+    EXPECT_TRUE(same(abs[i], S{abs_expected[i]})) << i;
+  }
+
+  /* no split kernel, the scalar float function */
+  gsl::math::arcsin<S>(in, out);
+  for (std::size_t i = 0; i < in.size(); i++) {
+    EXPECT_TRUE(same(out[i], gsl::type::complex_base<S>(
+                                 gsl::math::arcsin<float>(wide[i]))))
+        << i;
+  }
+}
+
+}  // namespace
+
+TEST(GSLMathHalf, Float16ConversionTest) {
+  /* every float16 survives the round trip through float */
+  for (std::uint32_t b = 0; b < 0x10000; b++) {
+    const auto h = float16::from_bits(static_cast<std::uint16_t>(b));
+    const float f = h;
+    if (std::isnan(f)) {
+      EXPECT_EQ(float16{f}.bits(), b | 0x200u) << b;
+    } else {
+      EXPECT_EQ(float16{f}.bits(), b) << b;
+    }
+  }
+
+  /* round to nearest even, overflow and underflow */
+  EXPECT_EQ(float16{1 + 0x1p-11F}.bits(), 0x3c00);
+  EXPECT_EQ(float16{1 + 0x3p-11F}.bits(), 0x3c02);
+  EXPECT_EQ(float16{0x1.00201p+0F}.bits(), 0x3c01);
+  EXPECT_EQ(float16{65519.0F}.bits(), 0x7bff);
+  EXPECT_EQ(float16{65520.0F}.bits(), 0x7c00);
+  EXPECT_EQ(float16{-1e10F}.bits(), 0xfc00);
+  EXPECT_EQ(float16{0x1p-24F}.bits(), 0x0001);
+  EXPECT_EQ(float16{0x1p-25F}.bits(), 0x0000);
+  EXPECT_EQ(float16{0x1.8p-25F}.bits(), 0x0001);
+  EXPECT_EQ(float16{-0.0F}.bits(), 0x8000);
+  EXPECT_EQ(float16{bits_to_float(0x7f800001)}.bits(), 0x7e00);
+
+#ifdef __FLT16_MANT_DIG__
+  /* against the compiler's conversion, over a walk of the floats */
+  for (std::uint64_t u = 0; u < (1ULL << 32); u += 65521) {
+    const float f = bits_to_float(static_cast<std::uint32_t>(u));
+    if (std::isnan(f)) continue;
+    EXPECT_EQ(float16{f}.bits(),
+              std::bit_cast<std::uint16_t>(static_cast<_Float16>(f)))
+        << f;
+  }
+#endif
+}
+
+TEST(GSLMathHalf, BFloat16ConversionTest) {
+  for (std::uint32_t b = 0; b < 0x10000; b++) {
+    const auto h = bfloat16::from_bits(static_cast<std::uint16_t>(b));
+    const float f = h;
+    if (std::isnan(f)) {
+      EXPECT_EQ(bfloat16{f}.bits(), b | 0x40u) << b;
+    } else {
+      EXPECT_EQ(bfloat16{f}.bits(), b) << b;
+    }
+  }
+
+  EXPECT_EQ(bfloat16{1 + 0x1p-8F}.bits(), 0x3f80);
+  EXPECT_EQ(bfloat16{1 + 0x3p-8F}.bits(), 0x3f82);
+  EXPECT_EQ(bfloat16{0x1.01001p+0F}.bits(), 0x3f81);
+  EXPECT_EQ(bfloat16{std::numeric_limits<float>::max()}.bits(), 0x7f80);
+  EXPECT_EQ(bfloat16{bits_to_float(0x7f800001)}.bits(), 0x7fc0);
+}
+
+TEST(GSLMathHalf, LimitsTest) {
+  using L = std::numeric_limits<float16>;
+  EXPECT_EQ(static_cast<float>(L::epsilon()), 0x1p-10F);
+  EXPECT_EQ(static_cast<float>(L::max()), 65504.0F);
+  EXPECT_EQ(static_cast<float>(L::min()), 0x1p-14F);
+  EXPECT_EQ(static_cast<float>(L::denorm_min()), 0x1p-24F);
+  EXPECT_TRUE(std::isinf(static_cast<float>(L::infinity())));
+
+  using B = std::numeric_limits<bfloat16>;
+  EXPECT_EQ(static_cast<float>(B::epsilon()), 0x1p-7F);
+  EXPECT_EQ(static_cast<float>(B::min()), std::numeric_limits<float>::min());
+  EXPECT_TRUE(std::isnan(static_cast<float>(B::quiet_NaN())));
+}
+
+TEST(GSLMathHalf, ComplexTest) {
+  /* computed in float, rounded when stored */
+  const complex_float16 a{1.5F, -2.0F};
+  const complex_float16 b{0.1F, 3.0F};
+  const complex_float16 p = a * b;
+  const complex_float pf = complex_float(a) * complex_float(b);
+  EXPECT_EQ(p, complex_float16(pf));
+  EXPECT_EQ(a + b, complex_float16(complex_float(a) + complex_float(b)));
+
+  const complex_float16 r{complex_float16::polar, 2.0F, 0.5F};
+  EXPECT_EQ(r, complex_float16(complex_float{complex_float::polar, 2.0F,
+                                             static_cast<float>(
+                                                 float16{0.5F})}));
+  EXPECT_EQ(complex_bfloat16(complex_float{1 + 0x1p-8F, 1}).real(), 1.0F);
+}
+
+TEST(GSLMathHalf, BatchTest) {
+  using gsl::math::dispatch::isa;
+
+  for (const auto v : {isa::generic, isa::sse2, isa::avx2, isa::avx512}) {
+    if (!dispatch::select(v)) continue;
+    EXPECT_EQ(dispatch::table<float16>().variant, v);
+    check_batch<float16>();
+    check_batch<bfloat16>();
+  }
+
+  dispatch::select(dispatch::detected());
+}
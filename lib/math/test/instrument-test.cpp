@@ -0,0 +1,108 @@
+#include <gsl/math/accuracy.h>
+#include <gsl/math/complex.h>
+#include <gsl/math/complex_batch.h>
+#include <gsl/math/instrument.h>
+#include <gsl/type/complex.h>
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+using gsl::type::complex;
+
+namespace instrument = gsl::math::instrument;
+using instrument::fn;
+using instrument::path;
+
+TEST(GSLMathInstrument, NamesTest) {
+  EXPECT_EQ(instrument::name(fn::arg), "arg");
+  EXPECT_EQ(instrument::name(fn::arccoth), "arccoth");
+  EXPECT_EQ(instrument::name(fn::hull), "hull");
+  EXPECT_EQ(instrument::name(path::large_reduction), "large_reduction");
+
+  EXPECT_EQ(instrument::bucket(0), 0u);
+  EXPECT_EQ(instrument::bucket(1), 1u);
+  EXPECT_EQ(instrument::bucket(3), 2u);
+  EXPECT_EQ(instrument::bucket(256), 9u);
+  EXPECT_EQ(instrument::bucket(~std::size_t{0}),
+            instrument::histogram_buckets - 1);
+}
+
+TEST(GSLMathInstrument, DisabledTest) {
+  if (instrument::enabled) GTEST_SKIP() << "built with GSL_MATH_INSTRUMENT";
+
+  gsl::math::tan<double>(complex{0.5, 3});
+  const auto r = instrument::snapshot();
+  for (const auto &f : r.functions) {
+    EXPECT_EQ(f.calls, 0u);
+    EXPECT_EQ(f.batch_calls, 0u);
+  }
+}
+
+TEST(GSLMathInstrument, CallsAndPathsTest) {
+  if (!instrument::enabled) GTEST_SKIP() << "needs GSL_MATH_INSTRUMENT";
+  instrument::reset();
+
+  gsl::math::tan<double>(complex{0.5, 0.25});
+  gsl::math::tan<double>(complex{0.5, 3});
+  gsl::math::sin<double>(complex{1e10, 0});
+  gsl::math::sinh<double>(complex{710, 0});
+  gsl::math::sqrt<double>(complex{}, gsl::math::accuracy::robust);
+  gsl::math::arcsin<double>(complex{1e300, 1}, gsl::math::accuracy::robust);
+
+  const auto r = instrument::snapshot();
+  EXPECT_EQ(r[fn::tan].calls, 2u);
+  EXPECT_EQ(r[fn::tan].hits(path::overflow), 1u);
+  EXPECT_EQ(r[fn::sin].calls, 1u);
+  EXPECT_EQ(r[fn::sincos].hits(path::large_reduction), 1u);
+  EXPECT_EQ(r[fn::sinhcosh].hits(path::overflow), 1u);
+  EXPECT_EQ(r[fn::sqrt].calls, 1u);
+  EXPECT_EQ(r[fn::sqrt].hits(path::special_case), 1u);
+  EXPECT_EQ(r[fn::arcsin].calls, 1u);
+  EXPECT_EQ(r[fn::hull].hits(path::overflow), 1u);
+
+  constexpr auto folded = gsl::math::abs2<double>(complex{3, 4});
+  EXPECT_EQ(folded, 25);
+  EXPECT_EQ(instrument::snapshot()[fn::abs2].calls, 0u);
+}
+
+TEST(GSLMathInstrument, BatchTest) {
+  if (!instrument::enabled) GTEST_SKIP() << "needs GSL_MATH_INSTRUMENT";
+  instrument::reset();
+
+  std::vector<complex> in(300, complex{0.5, 2}), out(300);
+  gsl::math::tan<double>(in, out);
+  gsl::math::tan<double>(std::span<complex>{out}.first(5));
+  gsl::math::sec<double>(std::span<const complex>{in}.first(3),
+                         std::span{out});
+
+  const auto r = instrument::snapshot();
+  EXPECT_EQ(r[fn::tan].batch_calls, 2u);
+  EXPECT_EQ(r[fn::tan].batch_elements, 305u);
+  EXPECT_EQ(r[fn::tan].batch_sizes[instrument::bucket(300)], 1u);
+  EXPECT_EQ(r[fn::tan].batch_sizes[instrument::bucket(5)], 1u);
+  EXPECT_EQ(r[fn::tan].hits(path::overflow), 300u);
+  /* sec has no split kernel, its elements go through the scalar sec */
+  EXPECT_EQ(r[fn::sec].batch_calls, 1u);
+  EXPECT_EQ(r[fn::sec].calls, 3u);
+}
+
+TEST(GSLMathInstrument, ThreadsTest) {
+  if (!instrument::enabled) GTEST_SKIP() << "needs GSL_MATH_INSTRUMENT";
+  instrument::reset();
+
+  gsl::math::exp<double>(complex{1, 1});
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; t++) {
+    threads.emplace_back([] {
+      for (int i = 0; i < 100; i++) gsl::math::exp<double>(complex{1, 1});
+    });
+  }
+  for (auto &t : threads) t.join();
+
+  EXPECT_EQ(instrument::snapshot()[fn::exp].calls, 401u);
+
+  instrument::reset();
+  EXPECT_EQ(instrument::snapshot()[fn::exp].calls, 0u);
+}
@@ -0,0 +1,107 @@
+#include <gsl/math/complex.h>
+#include <gsl/math/complex_batch.h>
+#include <gsl/type/complex.h>
+#include <gsl/type/complex_view.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <complex>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+using gsl::type::as_complex;
+using gsl::type::as_interleaved;
+using gsl::type::as_std_complex;
+using gsl::type::complex;
+using gsl::type::complex_base;
+using gsl::type::complex_float;
+
+namespace {
+
+template <typename T>
+std::vector<std::complex<T>> samples(std::size_t n) {
+  std::vector<std::complex<T>> r;
+  for (std::size_t i = 0; i < n; i++) {
+    const auto x = static_cast<T>(i) / 64;
+    r.emplace_back(x - 2, 1 - x / 3);
+  }
+  return r;
+}
+
+}  // namespace
+
+TEST(GSLMathInterop, StdComplexTest) {
+  const auto in = samples<double>(1000);
+  std::vector<std::complex<double>> out(in.size());
+
+  /* the views alias the buffers */
+  const auto v = as_complex(in);
+  static_assert(
+      std::is_same_v<decltype(v), const std::span<const complex>>);
+  EXPECT_EQ(static_cast<const void*>(v.data()), in.data());
+  EXPECT_EQ(v.size(), in.size());
+
+  /* to a few ulps of |exp|, the batch kernels may use vector libm */
+  gsl::math::exp<double>(as_complex(in), as_complex(out));
+  for (std::size_t i = 0; i < in.size(); i++) {
+    const auto e = std::exp(in[i]);
+    EXPECT_NEAR(out[i].real(), e.real(), 1e-14 * std::abs(e)) << i;
+    EXPECT_NEAR(out[i].imag(), e.imag(), 1e-14 * std::abs(e)) << i;
+  }
+
+  /* in place, and through the other direction */
+  const auto before = out[5];
+  gsl::math::conjugate<double>(as_complex(out));
+  EXPECT_EQ(out[5], std::conj(before));
+
+  std::vector<complex> g = {{1, 2}, {3, -4}};
+  auto s = as_std_complex(g);
+  s[1] *= std::complex<double>(0, 1);
+  EXPECT_EQ(g[1], (complex{4, 3}));
+  EXPECT_EQ(std::abs(as_std_complex(std::as_const(g))[0]), std::sqrt(5.0));
+}
+
+TEST(GSLMathInterop, InterleavedTest) {
+  /* (1, 2) (3, 4) (5, 6) as a C array of floats */
+  float a[] = {1, 2, 3, 4, 5, 6};
+  float b[] = {0, 1, 0, 1, 0, 1};
+  std::array<float, 6> c{};
+
+  const auto z = as_complex(a, 3);
+  EXPECT_EQ(z[1], (complex_float{3, 4}));
+  gsl::math::mul<float>(as_complex(std::as_const(a), 3), as_complex(b, 3),
+                        as_complex(c.data(), 3));
+  EXPECT_EQ(c, (std::array<float, 6>{-2, 1, -4, 3, -6, 5}));
+
+  /* and back, 2 n scalars */
+  std::vector<complex_float> w = {{1, -1}, {2, -2}};
+  const auto x = as_interleaved(w);
+  ASSERT_EQ(x.size(), 4U);
+  EXPECT_EQ(x[2], 2);
+  x[3] = 7;
+  EXPECT_EQ(w[1].img(), 7);
+}
+
+#if GSL_TYPE_C_COMPLEX
+TEST(GSLMathInterop, CComplexTest) {
+  using c_double = gsl::type::c_complex_t<double>;
+  std::vector<c_double> in(300), out(in.size());
+  for (std::size_t i = 0; i < in.size(); i++) {
+    __real__ in[i] = static_cast<double>(i) / 100;
+    __imag__ in[i] = -1;
+  }
+
+  gsl::math::sqrt<double>(as_complex(std::as_const(in)), as_complex(out));
+  for (std::size_t i = 0; i < in.size(); i++) {
+    const auto e = std::sqrt(std::complex<double>(__real__ in[i], -1));
+    EXPECT_NEAR(__real__ out[i], e.real(), 1e-14) << i;
+    EXPECT_NEAR(__imag__ out[i], e.imag(), 1e-14) << i;
+  }
+
+  std::vector<complex> g = {{1, 2}};
+  auto c = gsl::type::as_c_complex(g);
+  __imag__ c[0] = 5;
+  EXPECT_EQ(g[0], (complex{1, 5}));
+}
+#endif
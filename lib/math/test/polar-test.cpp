@@ -0,0 +1,119 @@
+#include <gsl/math/complex.h>
+#include <gsl/math/complex_batch.h>
+#include <gsl/math/dispatch.h>
+#include <gsl/type/complex.h>
+#include <gsl/type/polar_complex.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+using gsl::type::complex;
+using gsl::type::complex_float;
+using gsl::type::polar_complex;
+using gsl::type::polar_complex_double;
+using gsl::type::polar_complex_float;
+
+namespace dispatch = gsl::math::dispatch;
+
+namespace {
+
+bool near(const complex &a, const complex &b, double e) {
+  return (a - b).dist() <= e * std::max(b.dist(), 1.0);
+}
+
+}  // namespace
+
+TEST(GSLMathPolar, ScalarTest) {
+  const complex a{0.3, -1.7}, b{-2.5, 0.4};
+  const polar_complex_double pa{a}, pb{b};
+  EXPECT_DOUBLE_EQ(pa.dist(), a.dist());
+  EXPECT_DOUBLE_EQ(pa.angle_in_rads(), a.angle_in_rads());
+
+  EXPECT_TRUE(near((pa * pb).rect(), a * b, 4e-16));
+  EXPECT_TRUE(near((pa / pb).rect(), a / b, 4e-16));
+  EXPECT_TRUE(near(pa.inverse().rect(), a.inverse(), 4e-16));
+  EXPECT_TRUE(near(pa.conjugate().rect(), a.congugate(), 4e-16));
+  EXPECT_TRUE(near((-pa).rect(), -a, 4e-16));
+  EXPECT_TRUE(near(pa.pow(3).rect(), a * a * a, 1e-15));
+  EXPECT_TRUE(near(pa.pow(-2).rect(), (a * a).inverse(), 1e-15));
+  EXPECT_TRUE(near(pa.sqrt().rect(), gsl::math::sqrt<double>(a), 4e-16));
+  EXPECT_TRUE(near(pa.root(3).pow(3).rect(), a, 1e-15));
+  EXPECT_TRUE(near(pa.pow(0.5).rect(), gsl::math::sqrt<double>(a), 4e-16));
+  EXPECT_TRUE(near(pa.log(), gsl::math::log<double>(a), 4e-16));
+  EXPECT_TRUE(near(static_cast<complex>(polar_complex_double::I), complex::I,
+                   1e-16));
+
+  /* a negative magnitude and the angle folded into [-pi, pi] */
+  const polar_complex_double n{-2, 7.5};
+  EXPECT_EQ(n.dist(), 2);
+  EXPECT_NEAR(n.angle_in_rads(), 7.5 + M_PI - 4 * M_PI, 1e-15);
+  EXPECT_NEAR(pa.pow(1001).angle_in_rads(),
+              std::remainder(1001 * pa.angle_in_rads(), 2 * M_PI), 1e-12);
+
+  /* more turns than a long long holds */
+  const auto two_pi = 2 * gsl::math::real::pi<double>;
+  for (const double a : {1e20, -3e100, 1e308}) {
+    const polar_complex_double big{1, a};
+    EXPECT_LE(std::abs(big.angle_in_rads()), M_PI) << a;
+    EXPECT_EQ(big.angle_in_rads(), std::remainder(a, two_pi)) << a;
+  }
+  EXPECT_LE(std::abs(pa.pow(1e300).angle_in_rads()), M_PI);
+
+  /* constant evaluation */
+  constexpr polar_complex<double> c{2, 3};
+  static_assert((c * c).dist() == 4);
+  static_assert((c * c).angle_in_rads() < 0);
+  constexpr polar_complex<double> far{1, 1e300};
+  EXPECT_EQ(far.angle_in_rads(),
+            std::remainder(1e300, 2 * gsl::math::real::pi<double>));
+}
+
+TEST(GSLMathPolar, ChainTest) {
+  /* a rotation applied a million times stays on the unit circle and in
+   * [-pi, pi] */
+  const polar_complex_double step{1, 0.001};
+  auto p = polar_complex_double::ONE;
+  for (int k = 0; k < 1000000; k++) p *= step;
+  EXPECT_EQ(p.dist(), 1);
+  EXPECT_LE(std::abs(p.angle_in_rads()), M_PI);
+  EXPECT_NEAR(p.angle_in_rads(), std::remainder(1000.0, 2 * M_PI), 1e-9);
+}
+
+TEST(GSLMathPolar, BatchTest) {
+  std::vector<complex_float> z;
+  for (int k = 0; k < 700; k++) {
+    z.emplace_back(std::cos(0.37F * static_cast<float>(k)) * (1 + k % 5),
+                   std::sin(0.11F * static_cast<float>(k)) - 0.5F);
+  }
+  std::vector<polar_complex_float> p(z.size()), q(z.size());
+  std::vector<complex_float> back(z.size());
+
+  for (const auto v : {dispatch::isa::generic, dispatch::isa::sse2,
+                       dispatch::isa::avx2, dispatch::isa::avx512}) {
+    if (!dispatch::select(v)) continue;
+    gsl::math::to_polar<float>(z, p);
+    for (std::size_t i = 0; i < z.size(); i++) {
+      EXPECT_NEAR(p[i].dist(), z[i].dist(), 2e-7F * z[i].dist()) << i;
+      EXPECT_NEAR(p[i].angle_in_rads(), z[i].angle_in_rads(), 4e-7F) << i;
+    }
+
+    gsl::type::mul<float>(p, p, q);
+    gsl::type::pow<float>(std::span<const polar_complex_float>{q}, -1, q);
+    gsl::math::from_polar<float>(q, back);
+    for (std::size_t i = 0; i < z.size(); i++) {
+      const auto e = (z[i] * z[i]).inverse();
+      EXPECT_LE((back[i] - e).dist(), 2e-6F * e.dist()) << i;
+    }
+
+    /* the principal root of z^-2 is z or -z */
+    gsl::type::root<float>(std::span<const polar_complex_float>{q}, -2, q);
+    gsl::type::div<float>(q, p, q);
+    for (const auto &r : q) {
+      EXPECT_NEAR(r.dist(), 1, 1e-6F);
+      EXPECT_NEAR(std::sin(r.angle_in_rads()), 0, 1e-6F);
+    }
+  }
+  dispatch::select(dispatch::detected());
+}
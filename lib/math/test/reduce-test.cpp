@@ -0,0 +1,170 @@
+#include <gsl/math/double_double.h>
+#include <gsl/math/half.h>
+#include <gsl/math/reduce.h>
+#include <gsl/type/complex.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <complex>
+#include <concepts>
+#include <limits>
+#include <span>
+#include <vector>
+
+using gsl::math::float16;
+using gsl::type::complex;
+using gsl::type::complex_float;
+using gsl::type::complex_float16;
+
+namespace accumulate = gsl::math::accumulate;
+
+namespace {
+
+constexpr float eps = std::numeric_limits<float>::epsilon();
+
+using wide = std::complex<long double>;
+
+float rel_error(const complex_float &f, const wide &expected) {
+  const wide d{f.real() - expected.real(), f.img() - expected.imag()};
+  return static_cast<float>(std::abs(d) / std::abs(expected));
+}
+
+/* positive terms of very different sizes, the float sum drops the small
+ * ones once it is large */
+std::vector<complex_float> series(int n) {
+  std::vector<complex_float> v;
+  for (int i = 0; i < n; i++) {
+    v.emplace_back(1 + 0.1F * static_cast<float>(i % 7),
+                   0.001F * static_cast<float>(i % 13));
+  }
+  return v;
+}
+
+wide to_wide(const complex_float &z) { return {z.real(), z.img()}; }
+
+}  // namespace
+
+TEST(GSLMathReduce, SumTest) {
+  const auto v = series(1 << 20);
+  wide expected;
+  complex_float naive;
+  for (const auto &z : v) {
+    expected += to_wide(z);
+    naive = naive + z;
+  }
+
+  const auto w = gsl::math::sum<float>(v);
+  const auto c = gsl::math::sum<float>(v, accumulate::compensated);
+  EXPECT_LE(rel_error(w, expected), eps);
+  EXPECT_LE(rel_error(c, expected), eps);
+  EXPECT_GT(rel_error(naive, expected), 64 * eps);
+
+  /* the empty sum and product */
+  EXPECT_EQ(gsl::math::sum<float>(std::span<const complex_float>{}),
+            complex_float{});
+  EXPECT_EQ(gsl::math::prod<float>(std::span<const complex_float>{}),
+            complex_float::ONE);
+}
+
+TEST(GSLMathReduce, DotTest) {
+  const auto a = series(100003);
+  std::vector<complex_float> b;
+  for (std::size_t i = 0; i < a.size(); i++) {
+    b.emplace_back(std::cos(0.01F * static_cast<float>(i)),
+                   std::sin(0.01F * static_cast<float>(i)));
+  }
+
+  wide dot, dotc;
+  for (std::size_t i = 0; i < a.size(); i++) {
+    dot += to_wide(a[i]) * to_wide(b[i]);
+    dotc += std::conj(to_wide(a[i])) * to_wide(b[i]);
+  }
+
+  EXPECT_LE(rel_error(gsl::math::dot<float>(a, b), dot), eps);
+  EXPECT_LE(rel_error(gsl::math::dotc<float>(a, b), dotc), eps);
+  EXPECT_LE(rel_error(gsl::math::dot<float>(a, b, accumulate::compensated),
+                      dot),
+            eps);
+  EXPECT_LE(rel_error(gsl::math::dotc<float>(a, b, accumulate::compensated),
+                      dotc),
+            eps);
+
+  /* over the shorter span */
+  EXPECT_EQ(gsl::math::dot<float>(std::span{a}.first(3), b),
+            gsl::math::dot<float>(std::span{a}.first(3),
+                                  std::span{b}.first(3)));
+}
+
+TEST(GSLMathReduce, ProdTest) {
+  std::vector<complex_float> v;
+  wide expected = 1;
+  for (int i = 0; i < 10000; i++) {
+    const complex_float z{complex_float::polar, 1.0F + 1e-5F,
+                          0.001F * static_cast<float>(i)};
+    v.push_back(z);
+    expected *= to_wide(z);
+  }
+  EXPECT_LE(rel_error(gsl::math::prod<float>(v), expected), eps);
+
+  std::vector<complex_float> out(v.size());
+  gsl::math::cumprod<float>(v, out);
+  wide running = 1;
+  for (std::size_t i = 0; i < v.size(); i++) {
+    running *= to_wide(v[i]);
+    EXPECT_LE(rel_error(out[i], running), eps) << i;
+  }
+}
+
+TEST(GSLMathReduce, CumsumTest) {
+  const auto v = series(5000);
+  std::vector<complex_float> w(v.size()), c(v.size());
+  gsl::math::cumsum<float>(v, w);
+  gsl::math::cumsum<float>(v, c, accumulate::compensated);
+
+  wide running;
+  for (std::size_t i = 0; i < v.size(); i++) {
+    running += to_wide(v[i]);
+    EXPECT_LE(rel_error(w[i], running), eps) << i;
+    EXPECT_LE(rel_error(c[i], running), eps) << i;
+  }
+
+  /* in place */
+  auto inout = v;
+  gsl::math::cumsum<float>(std::span{inout});
+  EXPECT_EQ(inout, w);
+}
+
+TEST(GSLMathReduce, StorageTest) {
+  /* the wide accumulation follows type_info<complex_base<T>>::SHORT_REAL */
+  static_assert(std::same_as<gsl::math::accumulate_type<float>, double>);
+  static_assert(std::same_as<gsl::math::accumulate_type<float16>, double>);
+  static_assert(std::same_as<gsl::math::accumulate_type<double>,
+                             gsl::math::double_double>);
+  static_assert(
+      std::same_as<gsl::math::accumulate_type<long double>, long double>);
+
+  /* float16 input, summed in double: only the result is rounded */
+  std::vector<complex_float16> v(10000, complex_float16{0.1F, -0.3F});
+  const double re = static_cast<float>(float16{0.1F});
+  const double im = static_cast<float>(float16{-0.3F});
+  const auto s = gsl::math::sum<float16>(v);
+  EXPECT_EQ(s, (complex_float16{static_cast<float>(re * 10000),
+                                static_cast<float>(im * 10000)}));
+
+  std::vector<complex_float16> out(v.size());
+  gsl::math::cumsum<float16>(v, out);
+  EXPECT_EQ(out.back(), s);
+}
+
+TEST(GSLMathReduce, DoubleTest) {
+  /* double is accumulated in double_double, the small terms between the
+   * cancelling large ones are kept */
+  std::vector<complex> v;
+  for (int k = 0; k < 1000; k++) {
+    v.emplace_back(k % 2 ? 1e16 : -1e16, 0);
+    v.emplace_back(1, 0.5);
+  }
+  EXPECT_EQ(gsl::math::sum<double>(v), (complex{1000, 500}));
+  EXPECT_EQ(gsl::math::sum<double>(v, accumulate::compensated),
+            (complex{1000, 500}));
+}
@@ -0,0 +1,820 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <cstdlib>
+#include <ios>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <type_traits>
+
+namespace gsl::math {
+
+/* Double-double scalar
+ *
+ * The unevaluated sum hi + lo of two doubles with |lo| <= ulp(hi) / 2: a 106
+ * bit significand (about 32 decimal digits) with the exponent range of
+ * double, in 16 bytes like an x87 long double. Everything is done with
+ * double precision adds and multiplies, so the loops over double_double
+ * vectorize on the SSE/AVX units where long double loops cannot. The
+ * arithmetic is built from the error free transformations two_sum and
+ * two_prod; two_prod takes 2 instructions with a hardware fma (-mfma or a
+ * -march that has one, __FP_FAST_FMA) and 17 without, so build with fma
+ * for speed. The elementary functions of gsl::math::real below refine a
+ * double approximation or use a short Taylor series after an exact
+ * argument reduction, they cost several times the long double ones. The
+ * algorithms are those of
+ *
+ *   Y. Hida, X. S. Li and D. H. Bailey, "Library for Double-Double and
+ *   Quad-Double Arithmetic", 2007 (the QD library)
+ *
+ * with the accurate (IEEE) addition, which keeps the relative error of
+ * cancelling sums. They need IEEE double arithmetic rounded to nearest: no
+ * x87 excess precision, no -ffast-math and no contraction of a * b + c into
+ * an fma (-ffp-contract=off, the default of -std=c++20). Infinite and nan
+ * results are kept in hi with lo = 0. lo loses its bits first when the
+ * value nears the subnormal range, below about 1e-292 the precision drops
+ * towards double. sin and cos reduce their argument with a 160 bit pi / 2,
+ * they are accurate up to |x| of about 1e13. All of it but the output is
+ * constexpr, the double functions the elementary functions start from have
+ * a constant evaluation form in detail::dd. */
+
+class double_double;
+
+namespace detail::dd {
+
+/* integer tests and blends: with the default -ftrapping-math the compiler
+ * may not if-convert a floating point select, it turns it back into a
+ * branch and the loops over double_double no longer vectorize */
+constexpr bool finite(double x) {
+  constexpr auto exponent = std::uint64_t{0x7ff} << 52;
+  return (std::bit_cast<std::uint64_t>(x) & exponent) != exponent;
+}
+
+/* the unsigned integer of the bits of a float or double */
+template <typename T>
+using bits = std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+
+template <typename T>
+constexpr bool bit_blend = std::same_as<T, float> || std::same_as<T, double>;
+
+template <std::floating_point T>
+constexpr T blend(bool c, T a, T b) {
+  if constexpr (bit_blend<T>) {
+    const auto m = bits<T>{0} - c;
+    return std::bit_cast<T>((std::bit_cast<bits<T>>(a) & m) |
+                            (std::bit_cast<bits<T>>(b) & ~m));
+  } else {
+    return c ? a : b;
+  }
+}
+
+template <std::floating_point T>
+constexpr T fabs(T x) {
+  if constexpr (bit_blend<T>) {
+    return std::bit_cast<T>(std::bit_cast<bits<T>>(x) &
+                            ~(bits<T>{1} << (8 * sizeof(T) - 1)));
+  } else {
+    return x < 0 ? -x : x;
+  }
+}
+
+/* The error free transformations, of any floating point T: double_double
+ * is built from the double ones, the compensated reductions of
+ * gsl/math/reduce.h from those of their element type */
+
+/* s + e == a + b exactly, needs |a| >= |b| */
+template <std::floating_point T>
+constexpr std::array<T, 2> quick_two_sum(T a, T b) {
+  const T s = a + b;
+  return {s, b - (s - a)};
+}
+
+/* s + e == a + b exactly */
+template <std::floating_point T>
+constexpr std::array<T, 2> two_sum(T a, T b) {
+  const T s = a + b;
+  const T bb = s - a;
+  return {s, (a - (s - bb)) + (b - bb)};
+}
+
+/* hi + lo == a with halves of (digits + 1) / 2 bits, 26 for double
+ * (Dekker), scaled near overflow */
+template <std::floating_point T>
+constexpr std::array<T, 2> split(T a) {
+  constexpr int half = (std::numeric_limits<T>::digits + 1) / 2;
+  constexpr T splitter = static_cast<T>(std::uint64_t{1} << half) + 1;
+  constexpr T up = static_cast<T>(std::uint64_t{1} << (half + 1));
+  constexpr T big = std::numeric_limits<T>::max() / up;
+  const bool scaled = fabs(a) > big;
+  const T as = a * blend(scaled, 1 / up, T{1});
+  const T u = blend(scaled, up, T{1});
+  const T t = splitter * as;
+  const T hi = t - (t - as);
+  return {hi * u, (as - hi) * u};
+}
+
+/* whether the target has a fast fma of T */
+template <typename T>
+constexpr bool fast_fma =
+#ifdef __FP_FAST_FMAF
+    std::same_as<T, float> ||
+#endif
+#ifdef __FP_FAST_FMA
+    std::same_as<T, double> ||
+#endif
+#ifdef __FP_FAST_FMAL
+    std::same_as<T, long double> ||
+#endif
+    false;
+
+/* p + e == a * b exactly (barring underflow), with an fma when the target
+ * has a fast one */
+template <std::floating_point T>
+constexpr std::array<T, 2> two_prod(T a, T b) {
+  const T p = a * b;
+  if constexpr (fast_fma<T>) {
+    if (!std::is_constant_evaluated()) return {p, std::fma(a, b, -p)};
+  }
+  const auto [ah, al] = split(a);
+  const auto [bh, bl] = split(b);
+  return {p, ((ah * bh - p) + ah * bl + al * bh) + al * bl};
+}
+
+/* The std:: functions of double the elementary functions below use, with a
+ * form for constant evaluation: the classification and rounding functions
+ * are exact, sqrt, log, log1p and atan2 are seeds accurate to a few ulp
+ * for the Newton steps that follow them (log1p for |x| < 0.25, atan2 not
+ * for nan). At run time they are the std:: functions. */
+
+constexpr bool signbit(double x) {
+  return std::bit_cast<std::uint64_t>(x) >> 63;
+}
+
+constexpr bool isnan(double x) { return x != x; }
+
+constexpr bool isinf(double x) { return !finite(x) && x == x; }
+
+/* x 2^e, the factors are exact powers of two */
+constexpr double ldexp(double x, int e) {
+  if (!std::is_constant_evaluated()) return std::ldexp(x, e);
+  for (; e > 1000; e -= 1000) x *= 0x1p+1000;
+  for (; e < -1000; e += 1000) x *= 0x1p-1000;
+  return x *
+         std::bit_cast<double>(static_cast<std::uint64_t>(e + 1023) << 52);
+}
+
+/* the exponent of a finite non zero x */
+constexpr int ilogb(double x) {
+  if (!std::is_constant_evaluated()) return std::ilogb(x);
+  const bool sub = fabs(x) < 0x1p-1022;
+  x = sub ? x * 0x1p+54 : x;
+  const auto e = static_cast<int>((std::bit_cast<std::uint64_t>(x) >> 52) &
+                                  0x7ff);
+  return e - 1023 - (sub ? 54 : 0);
+}
+
+/* to the nearest integer, ties to even */
+constexpr double nearbyint(double x) {
+  if (!std::is_constant_evaluated()) return std::nearbyint(x);
+  constexpr double big = 0x1p+52;
+  if (!(fabs(x) < big)) return x;
+  const double r = signbit(x) ? (x - big) + big : (x + big) - big;
+  return r == 0 && signbit(x) ? -0.0 : r;
+}
+
+/* k mod 4 of an integral k */
+constexpr int quadrant(double k) {
+  if (!(fabs(k) < 0x1p+54)) return 0;
+  return static_cast<int>(static_cast<std::int64_t>(k) & 3);
+}
+
+/* k odd, for an integral k */
+constexpr bool odd(double k) {
+  return fabs(k) < 0x1p+53 && (static_cast<std::int64_t>(k) & 1) != 0;
+}
+
+constexpr double sqrt(double x) {
+  if (!std::is_constant_evaluated()) return std::sqrt(x);
+  if (!(x > 0) || isinf(x)) {
+    return x == 0 || x > 0 ? x : std::numeric_limits<double>::quiet_NaN();
+  }
+  int e = ilogb(x);
+  e -= e & 1;
+  const double m = ldexp(x, -e);
+  double y = (1 + m) / 2;
+  for (int i = 0; i < 6; i++) y = (y + m / y) / 2;
+  return ldexp(y, e / 2);
+}
+
+/* 2 atanh(t) = log((1 + t) / (1 - t)) for |t| <= 0.18 */
+constexpr double log_series(double t) {
+  const double t2 = t * t;
+  double s = 0;
+  for (int n = 29; n >= 3; n -= 2) s = (s + 1.0 / n) * t2;
+  return 2 * (t + t * s);
+}
+
+constexpr double log(double x) {
+  if (!std::is_constant_evaluated()) return std::log(x);
+  if (!(x > 0) || isinf(x)) {
+    if (x == 0) return -std::numeric_limits<double>::infinity();
+    return x > 0 ? x : std::numeric_limits<double>::quiet_NaN();
+  }
+  int e = ilogb(x);
+  double m = ldexp(x, -e);
+  if (m > 0x1.6a09e667f3bcdp+0) {
+    m /= 2;
+    e++;
+  }
+  return e * 0x1.62e42fefa39efp-1 + log_series((m - 1) / (m + 1));
+}
+
+/* |x| < 0.25 */
+constexpr double log1p(double x) {
+  if (!std::is_constant_evaluated()) return std::log1p(x);
+  return log_series(x / (2 + x));
+}
+
+/* y and x not nan; atan(t) for 0 <= t <= 1 from pi / 4 + atan of
+ * (t - 1) / (t + 1) above tan(pi / 8), then folded into the quadrant with
+ * the signed zeros and infinities of std::atan2 */
+constexpr double atan2(double y, double x) {
+  if (!std::is_constant_evaluated()) return std::atan2(y, x);
+  constexpr double pi = 0x1.921fb54442d18p+1;
+  const double ax = fabs(x), ay = fabs(y);
+  const bool swap = ay > ax;
+  double t = 0;
+  if (isinf(ax) && isinf(ay)) {
+    t = 1;
+  } else if (ay != 0) {
+    t = swap ? ax / ay : ay / ax;
+  }
+
+  const bool big = t > 0x1.a827999fcef32p-2;
+  const double u = big ? (t - 1) / (t + 1) : t;
+  const double u2 = u * u;
+  double s = 0;
+  for (int n = 51; n >= 3; n -= 2) {
+    s = (s + (n % 4 == 1 ? 1.0 : -1.0) / n) * u2;
+  }
+  double r = (big ? pi / 4 : 0) + (u + u * s);
+
+  r = swap ? pi / 2 - r : r;
+  r = signbit(x) ? pi - r : r;
+  return signbit(y) ? -r : r;
+}
+
+}  // namespace detail::dd
+
+class double_double {
+ public:
+  using packed_type = std::array<double, 2>;
+
+ private:
+  packed_type data{0, 0};
+
+  /* the result of an error free transformation, already normalized */
+  constexpr explicit double_double(const packed_type &p) : data{p} {}
+
+  static constexpr double_double renorm(double s, double e) {
+    return double_double{detail::dd::quick_two_sum(s, e)};
+  }
+
+  /* renorm(s, e), or the inf or nan of the leading part lead, blended
+   * without a branch */
+  static constexpr double_double settle(double lead, double s, double e) {
+    const auto r = detail::dd::quick_two_sum(s, e);
+    const bool ok = detail::dd::finite(lead);
+    return {detail::dd::blend(ok, r[0], lead),
+            detail::dd::blend(ok, r[1], 0.0)};
+  }
+
+ public:
+  constexpr double_double() = default;
+
+  /* hi + lo, |lo| <= ulp(hi) / 2 is assumed */
+  constexpr double_double(double hi, double lo) : data{hi, lo} {}
+
+  template <typename A>
+  requires std::is_arithmetic_v<A>
+  constexpr double_double(A a) {
+    if constexpr (std::is_floating_point_v<A> &&
+                  std::numeric_limits<A>::digits > 53) {
+      const double h = static_cast<double>(a);
+      data = {h, detail::dd::finite(h) ? static_cast<double>(a - h) : 0.0};
+    } else if constexpr (std::is_integral_v<A> &&
+                         std::numeric_limits<A>::digits > 53) {
+      const double h = static_cast<double>(a);
+      data = {h, static_cast<double>(static_cast<long double>(a) - h)};
+    } else {
+      data = {static_cast<double>(a), 0.0};
+    }
+  }
+
+  constexpr double hi() const { return std::get<0>(data); }
+  constexpr double lo() const { return std::get<1>(data); }
+
+  template <std::floating_point F>
+  constexpr explicit operator F() const {
+    if constexpr (std::numeric_limits<F>::digits > 53) {
+      /* keeps the sign of a zero hi */
+      if (lo() == 0) return static_cast<F>(hi());
+      return static_cast<F>(hi()) + static_cast<F>(lo());
+    } else {
+      return static_cast<F>(hi());
+    }
+  }
+
+  constexpr explicit operator bool() const { return hi() != 0; }
+
+  /* Arithmetic, the mixed forms with a double save the operations on its
+   * zero low part */
+
+  constexpr double_double operator-() const { return {-hi(), -lo()}; }
+  constexpr double_double operator+() const { return *this; }
+
+  friend constexpr double_double operator+(const double_double &a,
+                                           const double_double &b) {
+    const auto s = detail::dd::two_sum(a.hi(), b.hi());
+    const auto t = detail::dd::two_sum(a.lo(), b.lo());
+    const auto u = detail::dd::quick_two_sum(s[0], s[1] + t[0]);
+    return settle(s[0], u[0], u[1] + t[1]);
+  }
+
+  friend constexpr double_double operator+(const double_double &a, double b) {
+    const auto s = detail::dd::two_sum(a.hi(), b);
+    return settle(s[0], s[0], s[1] + a.lo());
+  }
+
+  friend constexpr double_double operator+(double a, const double_double &b) {
+    return b + a;
+  }
+
+  friend constexpr double_double operator-(const double_double &a,
+                                           const double_double &b) {
+    return a + -b;
+  }
+
+  friend constexpr double_double operator-(const double_double &a, double b) {
+    return a + -b;
+  }
+
+  friend constexpr double_double operator-(double a, const double_double &b) {
+    return -b + a;
+  }
+
+  friend constexpr double_double operator*(const double_double &a,
+                                           const double_double &b) {
+    const auto p = detail::dd::two_prod(a.hi(), b.hi());
+    return settle(p[0], p[0], p[1] + (a.hi() * b.lo() + a.lo() * b.hi()));
+  }
+
+  friend constexpr double_double operator*(const double_double &a, double b) {
+    const auto p = detail::dd::two_prod(a.hi(), b);
+    return settle(p[0], p[0], p[1] + a.lo() * b);
+  }
+
+  friend constexpr double_double operator*(double a, const double_double &b) {
+    return b * a;
+  }
+
+  /* three correction steps of the long division */
+  friend constexpr double_double operator/(const double_double &a,
+                                           const double_double &b) {
+    const double q1 = a.hi() / b.hi();
+    if (!detail::dd::finite(q1) || !detail::dd::finite(b.hi())) return {q1, 0};
+    auto r = a - b * q1;
+    const double q2 = r.hi() / b.hi();
+    r = r - b * q2;
+    const double q3 = r.hi() / b.hi();
+    return renorm(q1, q2) + q3;
+  }
+
+  friend constexpr double_double operator/(const double_double &a, double b) {
+    const double q1 = a.hi() / b;
+    if (!detail::dd::finite(q1) || !detail::dd::finite(b)) return {q1, 0};
+    const auto p = detail::dd::two_prod(q1, b);
+    const auto s = detail::dd::two_sum(a.hi(), -p[0]);
+    const double q2 = (s[0] + (s[1] - p[1] + a.lo())) / b;
+    return renorm(q1, q2);
+  }
+
+  friend constexpr double_double operator/(double a, const double_double &b) {
+    return double_double{a} / b;
+  }
+
+  template <typename R>
+  constexpr double_double &operator+=(const R &rhs) {
+    return *this = *this + rhs;
+  }
+
+  template <typename R>
+  constexpr double_double &operator-=(const R &rhs) {
+    return *this = *this - rhs;
+  }
+
+  template <typename R>
+  constexpr double_double &operator*=(const R &rhs) {
+    return *this = *this * rhs;
+  }
+
+  template <typename R>
+  constexpr double_double &operator/=(const R &rhs) {
+    return *this = *this / rhs;
+  }
+
+  /* Comparisons, ordered like the exact values, unordered with a nan */
+
+  friend constexpr bool operator==(const double_double &a,
+                                   const double_double &b) {
+    return a.hi() == b.hi() && a.lo() == b.lo();
+  }
+
+  friend constexpr std::partial_ordering operator<=>(const double_double &a,
+                                                     const double_double &b) {
+    const auto c = a.hi() <=> b.hi();
+    return c != 0 ? c : a.lo() <=> b.lo();
+  }
+};
+
+/* Elementary functions of double_double, the overloads of gsl::math::real
+ * (gsl/math/real.h) for it */
+namespace real {
+
+namespace detail {
+
+namespace dd = gsl::math::detail::dd;
+
+/* the constants to 106 bits, pi / 2 and ln2 with a third part for the
+ * argument reductions */
+constexpr double_double pi{0x1.921fb54442d18p+1, 0x1.1a62633145c07p-53};
+constexpr double_double pi_2{0x1.921fb54442d18p+0, 0x1.1a62633145c07p-54};
+constexpr double pi_2_third = -0x1.f1976b7ed8fbcp-110;
+constexpr double_double pi_4{0x1.921fb54442d18p-1, 0x1.1a62633145c07p-55};
+constexpr double_double pi3_4{0x1.2d97c7f3321d2p+1, 0x1.a79394c9e8a0ap-54};
+constexpr double_double ln2{0x1.62e42fefa39efp-1, 0x1.abc9e3b39803fp-56};
+constexpr double ln2_third = 0x1.7b57a079a1934p-111;
+constexpr double_double ln10{0x1.26bb1bbb55516p+1, -0x1.f48ad494ea3e9p-53};
+
+/* 1 / n! for n < 32 */
+constexpr auto inverse_factorials = [] {
+  std::array<double_double, 32> f{};
+  f[0] = 1;
+  for (std::size_t n = 1; n < f.size(); n++) f[n] = f[n - 1] / n;
+  return f;
+}();
+
+/* e^r - 1 for |r| <= ln2 / 2 / 512 up to the r^10 term, relative error
+ * below 2^-106 */
+constexpr double_double expm1_taylor(const double_double &r) {
+  double_double s = inverse_factorials[10];
+  for (int n = 9; n >= 1; n--) s = s * r + inverse_factorials[n];
+  return s * r;
+}
+
+/* a - k c for an integral k, c = c.hi() + c.lo() + third: the products by
+ * the parts of c are exact pairs, so the cancelling difference only carries
+ * the rounding of its own size */
+constexpr double_double reduce(const double_double &a, const double_double &c,
+                               double third, double k) {
+  using gsl::math::detail::dd::two_prod;
+  const auto p = two_prod(c.hi(), k);
+  const auto q = two_prod(c.lo(), k);
+  return (((a - p[0]) - p[1]) - q[0]) - (q[1] + third * k);
+}
+
+/* e^a - 1 = 2^m (s + 1) - 1, s = e^r - 1 from e^(512 r) = (s + 1)^512, the
+ * squarings are done on s to keep its relative accuracy */
+constexpr double_double expm1_reduced(const double_double &a, int &m) {
+  const double k = detail::dd::nearbyint(a.hi() / ln2.hi());
+  m = static_cast<int>(k);
+  const double_double r = reduce(a, ln2, ln2_third, k) * 0x1p-9;
+  double_double s = expm1_taylor(r);
+  for (int i = 0; i < 9; i++) s = s * 2 + s * s;
+  return s;
+}
+
+/* sin x for |x| <= pi / 4 up to the x^29 term, Horner in -x^2 */
+constexpr double_double sin_taylor(const double_double &x) {
+  const double_double t = -(x * x);
+  double_double s = inverse_factorials[29];
+  for (int n = 27; n >= 1; n -= 2) s = s * t + inverse_factorials[n];
+  return s * x;
+}
+
+}  // namespace detail
+
+constexpr bool isnan(const double_double &x) {
+  return detail::dd::isnan(x.hi());
+}
+
+constexpr bool isinf(const double_double &x) {
+  return detail::dd::isinf(x.hi());
+}
+
+constexpr bool isfinite(const double_double &x) {
+  return detail::dd::finite(x.hi());
+}
+
+constexpr bool signbit(const double_double &x) {
+  return detail::dd::signbit(x.hi());
+}
+
+constexpr double_double fabs(const double_double &x) {
+  return detail::dd::signbit(x.hi()) ? -x : x;
+}
+
+constexpr double_double copysign(const double_double &x,
+                                 const double_double &y) {
+  return detail::dd::signbit(x.hi()) != detail::dd::signbit(y.hi()) ? -x : x;
+}
+
+constexpr double_double ldexp(const double_double &x, int e) {
+  return {detail::dd::ldexp(x.hi(), e), detail::dd::ldexp(x.lo(), e)};
+}
+
+/* one Newton step on the double square root (Karp) */
+constexpr double_double sqrt(const double_double &a) {
+  if (!(a.hi() > 0) || detail::dd::isinf(a.hi())) {
+    return detail::dd::sqrt(a.hi());
+  }
+  const double x = 1 / detail::dd::sqrt(a.hi());
+  const double ax = a.hi() * x;
+  const auto p = gsl::math::detail::dd::two_prod(ax, ax);
+  const double d = (a - double_double{p[0], p[1]}).hi() * (x / 2);
+  const auto s = gsl::math::detail::dd::two_sum(ax, d);
+  return {s[0], s[1]};
+}
+
+constexpr double_double expm1(const double_double &a) {
+  if (detail::dd::isnan(a.hi())) return a;
+  if (a.hi() > 709.79) return std::numeric_limits<double>::infinity();
+  if (a.hi() < -80) return -1;
+  int m;
+  const double_double s = detail::expm1_reduced(a, m);
+  if (m == 0) return s;
+  return ldexp(s + 1, m) - 1;
+}
+
+constexpr double_double exp(const double_double &a) {
+  if (detail::dd::isnan(a.hi())) return a;
+  if (a.hi() > 709.79) return std::numeric_limits<double>::infinity();
+  if (a.hi() < -745.2) return 0;
+  int m;
+  const double_double s = detail::expm1_reduced(a, m);
+  return ldexp(s + 1, m);
+}
+
+constexpr double_double log(const double_double &a);
+
+/* Newton on expm1 from the double log1p, x - (e^x - 1 - a) / e^x keeps the
+ * relative accuracy of small a */
+constexpr double_double log1p(const double_double &a) {
+  if (!(detail::dd::fabs(a.hi()) < 0.25)) return log(a + 1);
+  if (a.hi() == 0) return a;
+  const double_double x = detail::dd::log1p(a.hi());
+  const double_double t = expm1(x);
+  return x - (t - a) / (t + 1);
+}
+
+/* Newton on exp from the double log, log1p near 1 where the result is small
+ * and a - 1 is exact */
+constexpr double_double log(const double_double &a) {
+  if (detail::dd::isnan(a.hi()) || detail::dd::isinf(a.hi()) || a.hi() <= 0) {
+    return detail::dd::log(a.hi());
+  }
+  if (a.hi() > 0.75 && a.hi() < 1.25) return log1p(a - 1);
+  const double_double x = detail::dd::log(a.hi());
+  return x + (a * exp(-x) - 1);
+}
+
+/* sin and cos from one Taylor series after the reduction by pi / 2 in three
+ * parts, cos = sqrt(1 - sin^2) is accurate for |r| <= pi / 4 */
+constexpr void sincos(const double_double &a, double_double &s,
+                   double_double &c) {
+  if (!detail::dd::finite(a.hi())) {
+    s = c = std::numeric_limits<double>::quiet_NaN();
+    return;
+  }
+  const double j = detail::dd::nearbyint(a.hi() / detail::pi_2.hi());
+  const double_double r =
+      detail::reduce(a, detail::pi_2, detail::pi_2_third, j);
+  const double_double sr = detail::sin_taylor(r);
+  const double_double cr = sqrt(1 - sr * sr);
+
+  switch (detail::dd::quadrant(j)) {
+    case 0:
+      s = sr, c = cr;
+      break;
+    case 1:
+      s = cr, c = -sr;
+      break;
+    case 2:
+      s = -sr, c = -cr;
+      break;
+    default:
+      s = -cr, c = sr;
+      break;
+  }
+}
+
+constexpr double_double sin(const double_double &a) {
+  double_double s, c;
+  sincos(a, s, c);
+  return s;
+}
+
+constexpr double_double cos(const double_double &a) {
+  double_double s, c;
+  sincos(a, s, c);
+  return c;
+}
+
+/* sqrt(a^2 + b^2), scaled by a power of two */
+constexpr double_double hypot(const double_double &a, const double_double &b) {
+  const double_double x = fabs(a), y = fabs(b);
+  if (isnan(x) || isnan(y)) return x.hi() + y.hi();
+  if (detail::dd::isinf(x.hi()) || detail::dd::isinf(y.hi())) {
+    return std::numeric_limits<double>::infinity();
+  }
+  const double_double m = std::max(x, y);
+  if (m.hi() == 0) return m;
+  const int e = detail::dd::ilogb(m.hi());
+  const double_double xs = ldexp(x, -e), ys = ldexp(y, -e);
+  return ldexp(sqrt(xs * xs + ys * ys), e);
+}
+
+/* one Newton step on the double atan2, on tan or cot of the angle whichever
+ * is better conditioned; the exact multiples of pi / 4 of the axes,
+ * diagonals and infinities are handled apart */
+constexpr double_double atan2(const double_double &y, const double_double &x) {
+  if (isnan(x) || isnan(y)) return x.hi() + y.hi();
+
+  const bool exact = x.hi() == 0 || y.hi() == 0 || detail::dd::isinf(x.hi()) ||
+                     detail::dd::isinf(y.hi()) || fabs(x) == fabs(y);
+  if (exact) {
+    /* atan2 is a multiple k of pi / 4 to within an ulp */
+    const double d = detail::dd::atan2(y.hi(), x.hi());
+    if (d == 0) return d;
+    return detail::pi_4 * detail::dd::nearbyint(d / detail::pi_4.hi());
+  }
+
+  const double_double r = hypot(x, y);
+  const double_double xx = x / r, yy = y / r;
+  double_double z = detail::dd::atan2(y.hi(), x.hi());
+  double_double sz, cz;
+  sincos(z, sz, cz);
+  if (detail::dd::fabs(xx.hi()) > detail::dd::fabs(yy.hi())) {
+    z += (yy - sz) / cz;
+  } else {
+    z -= (xx - cz) / sz;
+  }
+  return z;
+}
+
+/* e^(b log a), for a < 0 only integral b */
+constexpr double_double pow(const double_double &a, const double_double &b) {
+  if (b.hi() == 0 || a == 1) return 1;
+  if (detail::dd::isnan(a.hi()) || detail::dd::isnan(b.hi())) {
+    return a.hi() + b.hi();
+  }
+
+  const double_double ib = detail::dd::nearbyint(b.hi());
+  const bool integral = b == ib || detail::dd::fabs(b.hi()) >= 0x1p+53;
+  if (a.hi() < 0 && !integral) return std::numeric_limits<double>::quiet_NaN();
+  const bool odd = integral && detail::dd::odd(b.hi());
+
+  const double_double m = fabs(a);
+  double_double r;
+  if (m.hi() == 0 || detail::dd::isinf(m.hi())) {
+    r = (m.hi() == 0) == (b.hi() > 0) ? 0.0
+                                      : std::numeric_limits<double>::infinity();
+  } else {
+    r = exp(b * log(m));
+  }
+  return a.hi() < 0 && odd ? -r : r;
+}
+
+}  // namespace real
+
+/* printf %g like, with up to 32 significant digits of precision() */
+inline std::ostream &operator<<(std::ostream &out, const double_double &x) {
+  if (!std::isfinite(x.hi()) || x.hi() == 0) return out << x.hi();
+
+  const int digits = std::clamp<int>(out.precision(), 1, 32);
+  double_double r = real::fabs(x);
+  int e = static_cast<int>(std::floor(std::log10(r.hi())));
+
+  /* r / 10^e in [1, 10), the powers of ten by squaring, in two steps past
+   * the double range */
+  const auto pow10 = [](int n) {
+    double_double p = 1, b = 10;
+    for (; n; n >>= 1, b = b * b) {
+      if (n & 1) p = p * b;
+    }
+    return p;
+  };
+  if (e >= 0) {
+    r = r / pow10(e);
+  } else {
+    r = r * pow10(-e / 2) * pow10(-e - -e / 2);
+  }
+  if (r.hi() >= 10) r = r / 10, e++;
+  if (r.hi() < 1) r = r * 10, e--;
+
+  /* one more digit than shown for the rounding */
+  std::string d(digits + 1, '0');
+  for (auto &c : d) {
+    const int v = std::clamp(static_cast<int>(std::floor(r.hi())), 0, 9);
+    c = static_cast<char>('0' + v);
+    r = (r - v) * 10;
+  }
+  const bool up = d.back() >= '5';
+  d.pop_back();
+  for (auto i = d.size(); up && i-- > 0;) {
+    if (d[i] != '9') {
+      d[i]++;
+      break;
+    }
+    d[i] = '0';
+    if (i == 0) d.insert(d.begin(), '1'), d.pop_back(), e++;
+  }
+
+  std::string s = std::signbit(x.hi()) ? "-" : "";
+  if (e < -4 || e >= digits) {
+    s += d.substr(0, 1);
+    auto frac = d.substr(1);
+    frac.erase(frac.find_last_not_of('0') + 1);
+    if (!frac.empty()) s += "." + frac;
+    s += e < 0 ? "e-" : "e+";
+    const auto ex = std::to_string(std::abs(e));
+    s += (ex.size() < 2 ? "0" : "") + ex;
+  } else if (e >= 0) {
+    s += d.substr(0, e + 1);
+    auto frac = d.substr(e + 1);
+    frac.erase(frac.find_last_not_of('0') + 1);
+    if (!frac.empty()) s += "." + frac;
+  } else {
+    auto frac = std::string(-e - 1, '0') + d;
+    frac.erase(frac.find_last_not_of('0') + 1);
+    s += "0." + frac;
+  }
+  return out << s;
+}
+
+}  // namespace gsl::math
+
+namespace std {
+
+template <>
+struct numeric_limits<gsl::math::double_double> {
+ private:
+  using T = gsl::math::double_double;
+
+ public:
+  static constexpr bool is_specialized = true;
+  static constexpr bool is_signed = true;
+  static constexpr bool is_integer = false;
+  static constexpr bool is_exact = false;
+  static constexpr bool has_infinity = true;
+  static constexpr bool has_quiet_NaN = true;
+  static constexpr bool has_signaling_NaN = false;
+  static constexpr bool is_iec559 = false;
+  static constexpr bool is_bounded = true;
+  static constexpr bool is_modulo = false;
+  static constexpr int radix = 2;
+  static constexpr int digits = 106;
+  static constexpr int digits10 = 31;
+  static constexpr int max_digits10 = 33;
+  static constexpr int min_exponent = -1021 + 53;
+  static constexpr int min_exponent10 = -291;
+  static constexpr int max_exponent = 1024;
+  static constexpr int max_exponent10 = 308;
+  static constexpr std::float_round_style round_style = std::round_to_nearest;
+
+  static constexpr T min() noexcept { return 0x1p-969; }
+  static constexpr T max() noexcept {
+    return {0x1.fffffffffffffp+1023, 0x1.fffffffffffffp+969};
+  }
+  static constexpr T lowest() noexcept { return -max(); }
+  static constexpr T epsilon() noexcept { return 0x1p-104; }
+  static constexpr T round_error() noexcept { return 0.5; }
+  static constexpr T infinity() noexcept {
+    return std::numeric_limits<double>::infinity();
+  }
+  static constexpr T quiet_NaN() noexcept {
+    return std::numeric_limits<double>::quiet_NaN();
+  }
+  static constexpr T denorm_min() noexcept {
+    return std::numeric_limits<double>::denorm_min();
+  }
+};
+
+}  // namespace std
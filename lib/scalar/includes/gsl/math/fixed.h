@@ -0,0 +1,191 @@
+#pragma once
+
+#include <bit>
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace gsl::math {
+
+/* Fixed point scalars
+ *
+ * fixed<Raw, F> stores a value v as the signed integer round(v * 2^F), q15
+ * and q31 are the usual fractions in [-1, 1). The arithmetic saturates
+ * instead of wrapping: + and - clamp to the range, * rounds the exact
+ * product to nearest (ties up) and clamps, so q15(-1) * q15(-1) gives the
+ * largest q15 rather than -1. The conversion from float rounds to nearest
+ * even and saturates, nan gives 0. Everything is integer code that is
+ * exact in constant expressions and vectorizes over arrays. */
+
+namespace detail::fixed {
+
+/* the signed integer of twice the width, where it exists */
+template <typename T>
+struct wider {};
+template <>
+struct wider<std::int8_t> {
+  using type = std::int16_t;
+};
+template <>
+struct wider<std::int16_t> {
+  using type = std::int32_t;
+};
+template <>
+struct wider<std::int32_t> {
+  using type = std::int64_t;
+};
+
+template <typename T>
+using wider_t = typename wider<T>::type;
+
+template <typename T>
+concept widenable = requires { typename wider<T>::type; };
+
+template <std::signed_integral T, std::signed_integral W>
+constexpr T saturate(W x) {
+  constexpr W lo = std::numeric_limits<T>::min();
+  constexpr W hi = std::numeric_limits<T>::max();
+  return static_cast<T>(x < lo ? lo : x > hi ? hi : x);
+}
+
+/* a + b and a - b clamped to T: in the wider type when there is one (the
+ * pattern of paddsw and friends), otherwise with the wrapped sum and the
+ * sign rule of the overflow */
+template <std::signed_integral T>
+constexpr T add_sat(T a, T b) {
+  if constexpr (widenable<T>) {
+    return saturate<T>(static_cast<wider_t<T>>(a) + b);
+  } else {
+    using U = std::make_unsigned_t<T>;
+    const T s = static_cast<T>(static_cast<U>(a) + static_cast<U>(b));
+    const T limit = a < 0 ? std::numeric_limits<T>::min()
+                          : std::numeric_limits<T>::max();
+    return ((a ^ s) & (b ^ s)) < 0 ? limit : s;
+  }
+}
+
+template <std::signed_integral T>
+constexpr T sub_sat(T a, T b) {
+  if constexpr (widenable<T>) {
+    return saturate<T>(static_cast<wider_t<T>>(a) - b);
+  } else {
+    using U = std::make_unsigned_t<T>;
+    const T s = static_cast<T>(static_cast<U>(a) - static_cast<U>(b));
+    const T limit = a < 0 ? std::numeric_limits<T>::min()
+                          : std::numeric_limits<T>::max();
+    return ((a ^ b) & (a ^ s)) < 0 ? limit : s;
+  }
+}
+
+/* x rounded to nearest even and clamped to T, nan gives 0. |x| < 2^23 is
+ * rounded by adding and subtracting 2^23 to its magnitude, larger floats
+ * are integers already; the selects are masks on the bits because the
+ * vectorizer gives up on float compares mixed with selects. The largest
+ * float not above max() bounds the clamp, max() itself rounds up for T
+ * wider than the float significand. */
+template <std::signed_integral T>
+constexpr T from_float(float x) {
+  constexpr T max = std::numeric_limits<T>::max();
+  constexpr float hi = static_cast<float>(max - (max >> 24));
+  constexpr float lo = static_cast<float>(std::numeric_limits<T>::min());
+
+  const auto u = std::bit_cast<std::uint32_t>(x);
+  const auto a = u & 0x7fffffffu;
+  const float m = (std::bit_cast<float>(a) + 0x1p23F) - 0x1p23F;
+  const auto r = std::bit_cast<std::uint32_t>(m) | (u & 0x80000000u);
+  const std::uint32_t small = 0u - (a < 0x4b000000u);
+  const std::uint32_t number = 0u - (a <= 0x7f800000u);
+  x = std::bit_cast<float>(((r & small) | (u & ~small)) & number);
+  x = x < hi ? x : hi;
+  x = x > lo ? x : lo;
+  return static_cast<T>(x);
+}
+
+/* x / 2^F rounded to nearest, ties up, without the overflow of adding
+ * 2^(F - 1) first */
+template <int F, std::signed_integral T>
+constexpr T round_shift(T x) {
+  if constexpr (F == 0) {
+    return x;
+  } else {
+    return static_cast<T>((x >> F) + ((x >> (F - 1)) & 1));
+  }
+}
+
+template <int F>
+constexpr float scale = 2 * scale<F - 1>;
+template <>
+constexpr float scale<0> = 1;
+
+}  // namespace detail::fixed
+
+template <std::signed_integral Raw, int F>
+  requires(F >= 0 && F <= std::numeric_limits<Raw>::digits)
+class fixed {
+ public:
+  using raw_type = Raw;
+  static constexpr int fraction_bits = F;
+
+  constexpr fixed() = default;
+  constexpr explicit fixed(float f)
+      : bits_{detail::fixed::from_float<Raw>(f * detail::fixed::scale<F>)} {}
+
+  constexpr explicit operator float() const {
+    return static_cast<float>(bits_) / detail::fixed::scale<F>;
+  }
+
+  static constexpr fixed from_bits(Raw b) {
+    fixed q;
+    q.bits_ = b;
+    return q;
+  }
+  constexpr Raw bits() const { return bits_; }
+
+  constexpr bool operator==(const fixed &) const = default;
+  constexpr auto operator<=>(const fixed &) const = default;
+
+  constexpr fixed operator+(fixed rhs) const {
+    return from_bits(detail::fixed::add_sat(bits_, rhs.bits_));
+  }
+  constexpr fixed operator-(fixed rhs) const {
+    return from_bits(detail::fixed::sub_sat(bits_, rhs.bits_));
+  }
+  constexpr fixed operator-() const {
+    return from_bits(detail::fixed::sub_sat(Raw{0}, bits_));
+  }
+
+  /* the product has 2F fraction bits, round off F of them */
+  constexpr fixed operator*(fixed rhs) const
+    requires detail::fixed::widenable<Raw>
+  {
+    using W = detail::fixed::wider_t<Raw>;
+    const W p = static_cast<W>(bits_) * rhs.bits_;
+    return from_bits(
+        detail::fixed::saturate<Raw>(detail::fixed::round_shift<F>(p)));
+  }
+
+  constexpr fixed &operator+=(fixed rhs) { return *this = *this + rhs; }
+  constexpr fixed &operator-=(fixed rhs) { return *this = *this - rhs; }
+  constexpr fixed &operator*=(fixed rhs) { return *this = *this * rhs; }
+
+ private:
+  Raw bits_ = 0;
+};
+
+using q7 = fixed<std::int8_t, 7>;
+using q15 = fixed<std::int16_t, 15>;
+using q31 = fixed<std::int32_t, 31>;
+
+static_assert(sizeof(q15) == 2 && sizeof(q31) == 4);
+
+template <typename T>
+struct is_fixed : std::false_type {};
+template <std::signed_integral Raw, int F>
+struct is_fixed<fixed<Raw, F>> : std::true_type {};
+
+template <typename T>
+concept fixed_scalar = is_fixed<T>::value;
+
+}  // namespace gsl::math
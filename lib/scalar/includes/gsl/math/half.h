@@ -0,0 +1,218 @@
+#pragma once
+
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace gsl::math {
+
+/* 16 bit storage scalars
+ *
+ * float16 is IEEE binary16 (5 exponent bits, 11 bit significand) and
+ * bfloat16 the upper half of a float (8 exponent bits, 8 bit significand).
+ * They only store values: a float16 converts implicitly to float and back,
+ * so an expression on them is computed in float and rounded (to nearest
+ * even) when it is stored. complex_base<float16> takes half the memory of
+ * complex_float; the batch functions of gsl/math/complex_batch.h widen each
+ * block to float, run the float kernels and narrow the result, with the
+ * F16C / AVX-512 conversion instructions in the avx2 and avx512 variants.
+ * The scalar complex functions are not defined for them, call the float
+ * ones on a widened value.
+ *
+ * The conversions are integer code that is exact in constant expressions,
+ * they give the same bits as the hardware instructions: nan stays nan (the
+ * payload is truncated and made quiet), overflow rounds to infinity. A
+ * double is rounded through float. */
+
+namespace detail::half {
+
+constexpr float from_bits16(std::uint16_t h) {
+  /* move exponent and mantissa into place and rebias, then fix up inf/nan
+   * (the exponent is all ones) and subnormals (renormalized with one
+   * float subtraction) */
+  constexpr std::uint32_t shifted_exp = 0x7c00u << 13;
+  constexpr float magic = std::bit_cast<float>(113u << 23);
+
+  const std::uint32_t sign = static_cast<std::uint32_t>(h & 0x8000u) << 16;
+  std::uint32_t o = static_cast<std::uint32_t>(h & 0x7fffu) << 13;
+  const std::uint32_t exp = o & shifted_exp;
+  o += (127u - 15u) << 23;
+
+  const std::uint32_t special = o + ((128u - 16u) << 23);
+  const std::uint32_t sub = std::bit_cast<std::uint32_t>(
+      std::bit_cast<float>(o + (1u << 23)) - magic);
+  o = exp == shifted_exp ? special : o;
+  o = exp == 0 ? sub : o;
+  return std::bit_cast<float>(o | sign);
+}
+
+constexpr std::uint16_t to_bits16(float f) {
+  constexpr std::uint32_t f32_inf = 255u << 23;
+  constexpr std::uint32_t f16_max = (127u + 16u) << 23;
+  constexpr std::uint32_t denorm_magic = ((127u - 15u) + (23u - 10u) + 1u)
+                                         << 23;
+
+  std::uint32_t u = std::bit_cast<std::uint32_t>(f);
+  const std::uint32_t sign = u & 0x80000000u;
+  u ^= sign;
+
+  /* too large: infinity, nan: quiet nan with the top of the payload */
+  const std::uint32_t big =
+      u > f32_inf ? 0x7e00u | ((u >> 13) & 0x3ffu) : 0x7c00u;
+  /* subnormal: the float add rounds the mantissa into place */
+  const std::uint32_t sub =
+      std::bit_cast<std::uint32_t>(std::bit_cast<float>(u) +
+                                   std::bit_cast<float>(denorm_magic)) -
+      denorm_magic;
+  /* normal: rebias and round to nearest even */
+  const std::uint32_t odd = (u >> 13) & 1u;
+  const std::uint32_t normal =
+      (u + ((15u - 127u) << 23) + 0xfffu + odd) >> 13;
+
+  std::uint32_t o = u < (113u << 23) ? sub : normal;
+  o = u >= f16_max ? big : o;
+  return static_cast<std::uint16_t>(o | (sign >> 16));
+}
+
+constexpr float from_bits_b16(std::uint16_t h) {
+  return std::bit_cast<float>(static_cast<std::uint32_t>(h) << 16);
+}
+
+constexpr std::uint16_t to_bits_b16(float f) {
+  const std::uint32_t u = std::bit_cast<std::uint32_t>(f);
+  const bool nan = (u & 0x7fffffffu) > 0x7f800000u;
+  const std::uint32_t rounded = (u + 0x7fffu + ((u >> 16) & 1u)) >> 16;
+  return static_cast<std::uint16_t>(nan ? (u >> 16) | 0x40u : rounded);
+}
+
+}  // namespace detail::half
+
+class float16 {
+ public:
+  constexpr float16() = default;
+  constexpr float16(float f) : bits_{detail::half::to_bits16(f)} {}
+
+  constexpr operator float() const {
+    return detail::half::from_bits16(bits_);
+  }
+
+  static constexpr float16 from_bits(std::uint16_t b) {
+    float16 h;
+    h.bits_ = b;
+    return h;
+  }
+  constexpr std::uint16_t bits() const { return bits_; }
+
+ private:
+  std::uint16_t bits_ = 0;
+};
+
+class bfloat16 {
+ public:
+  constexpr bfloat16() = default;
+  constexpr bfloat16(float f) : bits_{detail::half::to_bits_b16(f)} {}
+
+  constexpr operator float() const {
+    return detail::half::from_bits_b16(bits_);
+  }
+
+  static constexpr bfloat16 from_bits(std::uint16_t b) {
+    bfloat16 h;
+    h.bits_ = b;
+    return h;
+  }
+  constexpr std::uint16_t bits() const { return bits_; }
+
+ private:
+  std::uint16_t bits_ = 0;
+};
+
+static_assert(sizeof(float16) == 2 && sizeof(bfloat16) == 2);
+
+/* the storage scalars and the type they are computed in */
+template <typename T>
+concept storage_scalar =
+    std::same_as<T, float16> || std::same_as<T, bfloat16>;
+
+template <typename T>
+using compute_type = std::conditional_t<storage_scalar<T>, float, T>;
+
+}  // namespace gsl::math
+
+namespace std {
+
+template <>
+struct numeric_limits<gsl::math::float16> {
+ private:
+  using T = gsl::math::float16;
+
+ public:
+  static constexpr bool is_specialized = true;
+  static constexpr bool is_signed = true;
+  static constexpr bool is_integer = false;
+  static constexpr bool is_exact = false;
+  static constexpr bool has_infinity = true;
+  static constexpr bool has_quiet_NaN = true;
+  static constexpr bool has_signaling_NaN = false;
+  static constexpr bool is_iec559 = true;
+  static constexpr bool is_bounded = true;
+  static constexpr bool is_modulo = false;
+  static constexpr int radix = 2;
+  static constexpr int digits = 11;
+  static constexpr int digits10 = 3;
+  static constexpr int max_digits10 = 5;
+  static constexpr int min_exponent = -13;
+  static constexpr int min_exponent10 = -4;
+  static constexpr int max_exponent = 16;
+  static constexpr int max_exponent10 = 4;
+  static constexpr std::float_round_style round_style = std::round_to_nearest;
+
+  static constexpr T min() noexcept { return T::from_bits(0x0400); }
+  static constexpr T max() noexcept { return T::from_bits(0x7bff); }
+  static constexpr T lowest() noexcept { return T::from_bits(0xfbff); }
+  static constexpr T epsilon() noexcept { return T::from_bits(0x1400); }
+  static constexpr T round_error() noexcept { return T::from_bits(0x3800); }
+  static constexpr T infinity() noexcept { return T::from_bits(0x7c00); }
+  static constexpr T quiet_NaN() noexcept { return T::from_bits(0x7e00); }
+  static constexpr T denorm_min() noexcept { return T::from_bits(0x0001); }
+};
+
+template <>
+struct numeric_limits<gsl::math::bfloat16> {
+ private:
+  using T = gsl::math::bfloat16;
+
+ public:
+  static constexpr bool is_specialized = true;
+  static constexpr bool is_signed = true;
+  static constexpr bool is_integer = false;
+  static constexpr bool is_exact = false;
+  static constexpr bool has_infinity = true;
+  static constexpr bool has_quiet_NaN = true;
+  static constexpr bool has_signaling_NaN = false;
+  static constexpr bool is_iec559 = false;
+  static constexpr bool is_bounded = true;
+  static constexpr bool is_modulo = false;
+  static constexpr int radix = 2;
+  static constexpr int digits = 8;
+  static constexpr int digits10 = 2;
+  static constexpr int max_digits10 = 4;
+  static constexpr int min_exponent = -125;
+  static constexpr int min_exponent10 = -37;
+  static constexpr int max_exponent = 128;
+  static constexpr int max_exponent10 = 38;
+  static constexpr std::float_round_style round_style = std::round_to_nearest;
+
+  static constexpr T min() noexcept { return T::from_bits(0x0080); }
+  static constexpr T max() noexcept { return T::from_bits(0x7f7f); }
+  static constexpr T lowest() noexcept { return T::from_bits(0xff7f); }
+  static constexpr T epsilon() noexcept { return T::from_bits(0x3c00); }
+  static constexpr T round_error() noexcept { return T::from_bits(0x3f00); }
+  static constexpr T infinity() noexcept { return T::from_bits(0x7f80); }
+  static constexpr T quiet_NaN() noexcept { return T::from_bits(0x7fc0); }
+  static constexpr T denorm_min() noexcept { return T::from_bits(0x0001); }
+};
+
+}  // namespace std
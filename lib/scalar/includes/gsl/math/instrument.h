@@ -0,0 +1,337 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace gsl::math::instrument {
+
+/* Instrumentation counters of the complex functions
+ *
+ * Built with GSL_MATH_INSTRUMENT defined (the GSL_MATH_INSTRUMENT CMake
+ * option, ignored in Release builds) the functions of gsl/math count
+ *
+ *   calls        every call of a scalar function, calls made by other
+ *                functions of the library count too (sec calls sin)
+ *   paths        how often a call took a slow path, per kind of path
+ *   batch sizes  a histogram of the sizes passed to the span overloads
+ *
+ * Each thread counts into its own block, nothing is shared on the counting
+ * side. snapshot() adds up the blocks of the running threads and the totals
+ * left by the threads that exited. Without GSL_MATH_INSTRUMENT the
+ * GSL_MATH_COUNT_* hooks expand to nothing, the query functions stay
+ * available and report zeros. */
+
+#ifdef GSL_MATH_INSTRUMENT
+constexpr bool enabled = true;
+#else
+constexpr bool enabled = false;
+#endif
+
+/* X(name) for each counted function: the functions of gsl/math/complex.h,
+ * the primitives of gsl/math/sincos.h, the stages of gsl/math/robust.h
+ * shared by several functions, the reductions of gsl/math/reduce.h and
+ * the polar conversions of gsl/math/complex_batch.h */
+#define GSL_MATH_INSTRUMENT_FUNCTIONS(X) \
+  X(arg)                                 \
+  X(abs)                                 \
+  X(abs2)                                \
+  X(logabs)                              \
+  X(add)                                 \
+  X(sub)                                 \
+  X(mul)                                 \
+  X(div)                                 \
+  X(add_real)                            \
+  X(sub_real)                            \
+  X(mul_real)                            \
+  X(div_real)                            \
+  X(add_imag)                            \
+  X(sub_imag)                            \
+  X(mul_imag)                            \
+  X(div_imag)                            \
+  X(conjugate)                           \
+  X(inverse)                             \
+  X(negative)                            \
+  X(sqrt)                                \
+  X(sqrt_real)                           \
+  X(pow)                                 \
+  X(pow_real)                            \
+  X(exp)                                 \
+  X(log)                                 \
+  X(log10)                               \
+  X(log_b)                               \
+  X(sin)                                 \
+  X(cos)                                 \
+  X(sec)                                 \
+  X(csc)                                 \
+  X(tan)                                 \
+  X(cot)                                 \
+  X(arcsin)                              \
+  X(arcsin_real)                         \
+  X(arccos)                              \
+  X(arccos_real)                         \
+  X(arcsec)                              \
+  X(arcsec_real)                         \
+  X(arccsc)                              \
+  X(arccsc_real)                         \
+  X(arctan)                              \
+  X(arccot)                              \
+  X(sinh)                                \
+  X(cosh)                                \
+  X(sech)                                \
+  X(csch)                                \
+  X(tanh)                                \
+  X(coth)                                \
+  X(arcsinh)                             \
+  X(arccosh)                             \
+  X(arccosh_real)                        \
+  X(arcsech)                             \
+  X(arccsch)                             \
+  X(arctanh)                             \
+  X(arctanh_real)                        \
+  X(arccoth)                             \
+  X(sincos)                              \
+  X(sinhcosh)                            \
+  X(hypot)                               \
+  X(hull)                                \
+  X(sum)                                 \
+  X(dot)                                 \
+  X(dotc)                                \
+  X(prod)                                \
+  X(cumsum)                              \
+  X(cumprod)                             \
+  X(to_polar)                            \
+  X(from_polar)
+
+enum class fn : unsigned {
+#define GSL_MATH_INSTRUMENT_ENUM(name) name,
+  GSL_MATH_INSTRUMENT_FUNCTIONS(GSL_MATH_INSTRUMENT_ENUM)
+#undef GSL_MATH_INSTRUMENT_ENUM
+};
+
+constexpr std::size_t function_count = 0
+#define GSL_MATH_INSTRUMENT_COUNT(name) +1
+    GSL_MATH_INSTRUMENT_FUNCTIONS(GSL_MATH_INSTRUMENT_COUNT);
+#undef GSL_MATH_INSTRUMENT_COUNT
+
+constexpr std::string_view name(fn f) {
+  constexpr std::string_view names[] = {
+#define GSL_MATH_INSTRUMENT_NAME(name) #name,
+      GSL_MATH_INSTRUMENT_FUNCTIONS(GSL_MATH_INSTRUMENT_NAME)
+#undef GSL_MATH_INSTRUMENT_NAME
+  };
+  return names[static_cast<unsigned>(f)];
+}
+
+enum class path : unsigned {
+  overflow,        /* rescaled or reformulated to avoid an overflow */
+  underflow,       /* rescaled or reformulated to avoid an underflow */
+  large_reduction, /* trigonometric argument past the fast reduction */
+  special_case     /* zero, infinite or cancelling inputs handled apart */
+};
+
+constexpr std::size_t path_count = 4;
+
+constexpr std::string_view name(path p) {
+  switch (p) {
+    case path::overflow:
+      return "overflow";
+    case path::underflow:
+      return "underflow";
+    case path::large_reduction:
+      return "large_reduction";
+    default:
+      return "special_case";
+  }
+}
+
+/* |x| from which libm leaves its short argument reduction for the
+ * multi-word one (glibc: Cody-Waite below, Payne-Hanek above) */
+template <typename T>
+constexpr T large_reduction = T{105414350};
+template <>
+constexpr float large_reduction<float> = 0x1p+17F;
+
+/* batch sizes are counted in power of two buckets, bucket k holds the sizes
+ * n with std::bit_width(n) == k: 0, 1, 2-3, 4-7, ... the last bucket takes
+ * everything larger */
+constexpr std::size_t histogram_buckets = 33;
+
+constexpr std::size_t bucket(std::size_t n) {
+  return std::min<std::size_t>(std::bit_width(n), histogram_buckets - 1);
+}
+
+struct function_counts {
+  std::uint64_t calls = 0;
+  std::array<std::uint64_t, path_count> paths{};
+  std::uint64_t batch_calls = 0;
+  std::uint64_t batch_elements = 0;
+  std::array<std::uint64_t, histogram_buckets> batch_sizes{};
+
+  constexpr std::uint64_t hits(path p) const {
+    return paths[static_cast<unsigned>(p)];
+  }
+};
+
+struct report {
+  std::array<function_counts, function_count> functions{};
+
+  constexpr const function_counts &operator[](fn f) const {
+    return functions[static_cast<unsigned>(f)];
+  }
+  constexpr function_counts &operator[](fn f) {
+    return functions[static_cast<unsigned>(f)];
+  }
+};
+
+namespace detail {
+
+/* only the owning thread writes a counter, the relaxed load and store pair
+ * needs no locked instruction, other threads read it for snapshot() */
+using counter = std::atomic<std::uint64_t>;
+
+inline void bump(counter &c, std::uint64_t n = 1) {
+  c.store(c.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+}
+
+struct function_block {
+  counter calls{0};
+  std::array<counter, path_count> paths{};
+  counter batch_elements{0};
+  std::array<counter, histogram_buckets> batch_sizes{};
+};
+
+struct block {
+  std::array<function_block, function_count> functions{};
+
+  void add_to(report &r) const {
+    for (std::size_t f = 0; f < function_count; f++) {
+      const auto &in = functions[f];
+      auto &out = r.functions[f];
+      out.calls += in.calls.load(std::memory_order_relaxed);
+      for (std::size_t p = 0; p < path_count; p++) {
+        out.paths[p] += in.paths[p].load(std::memory_order_relaxed);
+      }
+      out.batch_elements += in.batch_elements.load(std::memory_order_relaxed);
+      for (std::size_t b = 0; b < histogram_buckets; b++) {
+        const auto v = in.batch_sizes[b].load(std::memory_order_relaxed);
+        out.batch_sizes[b] += v;
+        out.batch_calls += v;
+      }
+    }
+  }
+
+  void clear() {
+    for (auto &f : functions) {
+      f.calls.store(0, std::memory_order_relaxed);
+      for (auto &c : f.paths) c.store(0, std::memory_order_relaxed);
+      f.batch_elements.store(0, std::memory_order_relaxed);
+      for (auto &c : f.batch_sizes) c.store(0, std::memory_order_relaxed);
+    }
+  }
+};
+
+/* the blocks of the running threads and the totals of the exited ones */
+struct registry {
+  std::mutex lock;
+  std::vector<const block *> live;
+  report retired;
+};
+
+inline registry &global() {
+  static registry r;
+  return r;
+}
+
+/* registers the block of a thread on its first count, folds it into the
+ * retired totals when the thread exits */
+struct slot {
+  block counts;
+
+  slot() {
+    auto &r = global();
+    std::lock_guard<std::mutex> g(r.lock);
+    r.live.push_back(&counts);
+  }
+
+  ~slot() {
+    auto &r = global();
+    std::lock_guard<std::mutex> g(r.lock);
+    counts.add_to(r.retired);
+    r.live.erase(std::find(r.live.begin(), r.live.end(), &counts));
+  }
+
+  slot(const slot &) = delete;
+  slot &operator=(const slot &) = delete;
+};
+
+inline function_block &local(fn f) {
+  thread_local slot s;
+  return s.counts.functions[static_cast<unsigned>(f)];
+}
+
+}  // namespace detail
+
+inline void call(fn f) { detail::bump(detail::local(f).calls); }
+
+inline void hit(fn f, path p) {
+  detail::bump(detail::local(f).paths[static_cast<unsigned>(p)]);
+}
+
+inline void batch(fn f, std::size_t n) {
+  auto &b = detail::local(f);
+  detail::bump(b.batch_elements, n);
+  detail::bump(b.batch_sizes[bucket(n)]);
+}
+
+/* the counts of all threads so far */
+inline report snapshot() {
+  auto &r = detail::global();
+  std::lock_guard<std::mutex> g(r.lock);
+  report out = r.retired;
+  for (const auto *b : r.live) b->add_to(out);
+  return out;
+}
+
+/* zero all counters, counts made concurrently by other threads may survive
+ * or be lost */
+inline void reset() {
+  auto &r = detail::global();
+  std::lock_guard<std::mutex> g(r.lock);
+  r.retired = {};
+  for (const auto *b : r.live) const_cast<detail::block *>(b)->clear();
+}
+
+}  // namespace gsl::math::instrument
+
+/* Hooks, usable in constexpr functions: nothing is counted during constant
+ * evaluation */
+
+#ifdef GSL_MATH_INSTRUMENT
+#define GSL_MATH_COUNT_CALL(name)                  \
+  (std::is_constant_evaluated()                    \
+       ? void()                                    \
+       : ::gsl::math::instrument::call(            \
+             ::gsl::math::instrument::fn::name))
+#define GSL_MATH_COUNT_PATH(name, kind) \
+  GSL_MATH_COUNT_PATH_IF(name, kind, true)
+#define GSL_MATH_COUNT_PATH_IF(name, kind, cond)                        \
+  ((std::is_constant_evaluated() || !(cond))                            \
+       ? void()                                                         \
+       : ::gsl::math::instrument::hit(::gsl::math::instrument::fn::name, \
+                                      ::gsl::math::instrument::path::kind))
+#define GSL_MATH_COUNT_BATCH(name, n)                                     \
+  ::gsl::math::instrument::batch(::gsl::math::instrument::fn::name, (n))
+#else
+#define GSL_MATH_COUNT_CALL(name) void()
+#define GSL_MATH_COUNT_PATH(name, kind) void()
+#define GSL_MATH_COUNT_PATH_IF(name, kind, cond) void()
+#define GSL_MATH_COUNT_BATCH(name, n) void()
+#endif
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+namespace gsl::math::dispatch {
+
+/* The instruction sets of the batch kernel variants
+ *
+ * The variants and their register widths as constants, for the layout
+ * traits of gsl/type/type_info.h. Binding a variant at run time is
+ * gsl/math/dispatch.h. */
+
+enum class isa {
+  generic, /* whatever the library was compiled for */
+  sse2,    /* x86-64 baseline */
+  avx2,    /* avx2 + fma + f16c */
+  avx512   /* avx512f + avx512dq + avx512vl + fma + f16c */
+};
+
+constexpr std::string_view name(isa v) {
+  switch (v) {
+    case isa::sse2:
+      return "sse2";
+    case isa::avx2:
+      return "avx2";
+    case isa::avx512:
+      return "avx512";
+    default:
+      return "generic";
+  }
+}
+
+/* the width of the vector registers of a variant in bytes, for generic the
+ * baseline of the target the code is compiled for, 0 without vector units */
+constexpr std::size_t register_bytes(isa v) {
+  switch (v) {
+    case isa::sse2:
+      return 16;
+    case isa::avx2:
+      return 32;
+    case isa::avx512:
+      return 64;
+    default:
+#if defined(__AVX512F__)
+      return 64;
+#elif defined(__AVX__)
+      return 32;
+#elif defined(__SSE2__) || defined(__ARM_NEON) || defined(__ALTIVEC__)
+      return 16;
+#else
+      return 0;
+#endif
+  }
+}
+
+/* the widest variant built for this target, buffers aligned for it suit
+ * every variant select() can bind */
+#if defined(__GNUC__) && defined(__x86_64__)
+constexpr isa widest = isa::avx512;
+#else
+constexpr isa widest = isa::generic;
+#endif
+
+}  // namespace gsl::math::dispatch
@@ -0,0 +1,245 @@
+#pragma once
+
+#include <gsl/constant/math.h>
+#include <gsl/math/double_double.h>
+
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+
+namespace gsl::math {
+
+/* The real scalars of the complex types: the built-in floating point types
+ * and double_double (gsl/math/double_double.h) */
+template <typename T>
+concept floating_scalar =
+    std::floating_point<T> || std::same_as<T, double_double>;
+
+namespace real {
+/* Real functions of the real scalars
+ *
+ * The complex functions call these instead of std::, so that they work for
+ * every floating_scalar: the templates forward to std:: for the built-in
+ * types, double_double has its own overloads. Both take and return T, a
+ * float argument calls the float function.
+ *
+ * All are constexpr. Under constant evaluation the templates do not call
+ * std:: (mostly not constexpr in C++20): the classification, sign, ldexp
+ * and fmod functions are done in T, the others are computed in double_double and
+ * rounded to T, which is within an ulp of the run time result and mostly
+ * equal to it (sin and cos for |x| up to about 1e13). A long double is
+ * evaluated there with the exponent range of double, and the sign of its
+ * zeros and nans is only seen for the x87 format. */
+
+namespace detail {
+
+/* the x87 80 bit extended format, padded */
+struct extended {
+  std::uint64_t significand;
+  std::uint16_t sign_exponent;
+};
+
+template <std::floating_point T>
+constexpr bool signbit(T x) {
+  if constexpr (sizeof(T) == sizeof(std::uint32_t)) {
+    return std::bit_cast<std::uint32_t>(x) >> 31;
+  } else if constexpr (sizeof(T) == sizeof(std::uint64_t)) {
+    return std::bit_cast<std::uint64_t>(x) >> 63;
+  } else if constexpr (std::numeric_limits<T>::digits == 64 &&
+                       sizeof(T) == sizeof(extended)) {
+    return std::bit_cast<extended>(x).sign_exponent >> 15;
+  } else {
+    return x < 0;
+  }
+}
+
+/* x 2^e by exact powers of two */
+template <std::floating_point T>
+constexpr T ldexp(T x, int e) {
+  for (; e >= 60; e -= 60) x *= static_cast<T>(0x1p+60);
+  for (; e <= -60; e += 60) x *= static_cast<T>(0x1p-60);
+  const auto p = static_cast<T>(std::uint64_t{1} << (e < 0 ? -e : e));
+  return e < 0 ? x / p : x * p;
+}
+
+/* x - n y, n = trunc(x / y), exactly: y 2^k subtracted from y 2^k <= |x|
+ * < y 2^(k + 1) leaves no rounding */
+template <std::floating_point T>
+constexpr T fmod(T x, T y) {
+  constexpr auto inf = std::numeric_limits<T>::infinity();
+  auto r = signbit(x) ? -x : x;
+  y = signbit(y) ? -y : y;
+  if (r != r || y != y || r == inf || y == 0) {
+    return std::numeric_limits<T>::quiet_NaN();
+  }
+  if (r < y) return x;
+  auto m = y;
+  while (m <= r / 2) m *= 2;
+  for (; m >= y; m /= 2) {
+    if (r >= m) r -= m;
+  }
+  return signbit(x) ? -r : r;
+}
+
+}  // namespace detail
+
+template <std::floating_point T>
+constexpr T fabs(T x) {
+  if (std::is_constant_evaluated()) return detail::signbit(x) ? -x : x;
+  return std::fabs(x);
+}
+
+template <std::floating_point T>
+constexpr T copysign(T x, T y) {
+  if (std::is_constant_evaluated()) {
+    return detail::signbit(x) != detail::signbit(y) ? -x : x;
+  }
+  return std::copysign(x, y);
+}
+
+template <std::floating_point T>
+constexpr T ldexp(T x, int e) {
+  if (std::is_constant_evaluated()) return detail::ldexp(x, e);
+  return std::ldexp(x, e);
+}
+
+template <std::floating_point T>
+constexpr T fmod(T x, T y) {
+  if (std::is_constant_evaluated()) return detail::fmod(x, y);
+  return std::fmod(x, y);
+}
+
+template <std::floating_point T>
+constexpr bool isnan(T x) {
+  if (std::is_constant_evaluated()) return x != x;
+  return std::isnan(x);
+}
+
+template <std::floating_point T>
+constexpr bool isinf(T x) {
+  if (std::is_constant_evaluated()) {
+    return x == std::numeric_limits<T>::infinity() ||
+           x == -std::numeric_limits<T>::infinity();
+  }
+  return std::isinf(x);
+}
+
+template <std::floating_point T>
+constexpr bool isfinite(T x) {
+  if (std::is_constant_evaluated()) return !isnan(x) && !isinf(x);
+  return std::isfinite(x);
+}
+
+template <std::floating_point T>
+constexpr bool signbit(T x) {
+  if (std::is_constant_evaluated()) return detail::signbit(x);
+  return std::signbit(x);
+}
+
+template <std::floating_point T>
+constexpr T sqrt(T x) {
+  if (std::is_constant_evaluated()) {
+    return static_cast<T>(sqrt(double_double{x}));
+  }
+  return std::sqrt(x);
+}
+
+template <std::floating_point T>
+constexpr T hypot(T x, T y) {
+  if (std::is_constant_evaluated()) {
+    return static_cast<T>(hypot(double_double{x}, double_double{y}));
+  }
+  return std::hypot(x, y);
+}
+
+template <std::floating_point T>
+constexpr T exp(T x) {
+  if (std::is_constant_evaluated()) {
+    return static_cast<T>(exp(double_double{x}));
+  }
+  return std::exp(x);
+}
+
+template <std::floating_point T>
+constexpr T expm1(T x) {
+  if (std::is_constant_evaluated()) {
+    return static_cast<T>(expm1(double_double{x}));
+  }
+  return std::expm1(x);
+}
+
+template <std::floating_point T>
+constexpr T log(T x) {
+  if (std::is_constant_evaluated()) {
+    return static_cast<T>(log(double_double{x}));
+  }
+  return std::log(x);
+}
+
+template <std::floating_point T>
+constexpr T log1p(T x) {
+  if (std::is_constant_evaluated()) {
+    return static_cast<T>(log1p(double_double{x}));
+  }
+  return std::log1p(x);
+}
+
+template <std::floating_point T>
+constexpr T pow(T x, T y) {
+  if (std::is_constant_evaluated()) {
+    return static_cast<T>(pow(double_double{x}, double_double{y}));
+  }
+  return std::pow(x, y);
+}
+
+template <std::floating_point T>
+constexpr T sin(T x) {
+  if (std::is_constant_evaluated()) {
+    return static_cast<T>(sin(double_double{x}));
+  }
+  return std::sin(x);
+}
+
+template <std::floating_point T>
+constexpr T cos(T x) {
+  if (std::is_constant_evaluated()) {
+    return static_cast<T>(cos(double_double{x}));
+  }
+  return std::cos(x);
+}
+
+template <std::floating_point T>
+constexpr T atan2(T y, T x) {
+  if (std::is_constant_evaluated()) {
+    return static_cast<T>(atan2(double_double{y}, double_double{x}));
+  }
+  return std::atan2(y, x);
+}
+
+/* Constants, to the precision of T */
+
+template <floating_scalar T>
+constexpr T pi = static_cast<T>(gsl::constant::math::PI);
+template <>
+constexpr double_double pi<double_double> = detail::pi;
+
+template <floating_scalar T>
+constexpr T pi_2 = static_cast<T>(gsl::constant::math::PI_2);
+template <>
+constexpr double_double pi_2<double_double> = detail::pi_2;
+
+template <floating_scalar T>
+constexpr T ln2 = static_cast<T>(gsl::constant::math::LN2);
+template <>
+constexpr double_double ln2<double_double> = detail::ln2;
+
+template <floating_scalar T>
+constexpr T ln10 = static_cast<T>(gsl::constant::math::LN10);
+template <>
+constexpr double_double ln10<double_double> = detail::ln10;
+
+}  // namespace real
+
+}  // namespace gsl::math
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <gsl/math/instrument.h>
+#include <gsl/math/real.h>
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+namespace gsl::math {
+
+/* Fused circular and hyperbolic pairs
+ *
+ * Most complex elementary functions need sin(x) and cos(x), or sinh(y) and
+ * cosh(y), of the same argument. These primitives reduce the argument once
+ * and return both values. The scalar forms work on a single value and are
+ * constexpr (through gsl/math/real.h), the batch forms on spans and
+ * process min() of the span sizes elements. */
+
+template <floating_scalar T>
+struct sincos_result {
+  T sin;
+  T cos;
+};
+
+template <floating_scalar T>
+struct sinhcosh_result {
+  T sinh;
+  T cosh;
+};
+
+template <floating_scalar T>
+constexpr sincos_result<T> sincos(T x) {
+  GSL_MATH_COUNT_CALL(sincos);
+  GSL_MATH_COUNT_PATH_IF(sincos, large_reduction,
+                         real::fabs(x) >= instrument::large_reduction<T>);
+  sincos_result<T> r;
+  if constexpr (std::same_as<T, double_double>) {
+    real::sincos(x, r.sin, r.cos);
+    return r;
+  }
+  if (std::is_constant_evaluated()) {
+    r.sin = real::sin(x);
+    r.cos = real::cos(x);
+    return r;
+  }
+#if defined(__GNUC__)
+  if constexpr (std::same_as<T, float>) {
+    __builtin_sincosf(x, &r.sin, &r.cos);
+  } else if constexpr (std::same_as<T, double>) {
+    __builtin_sincos(x, &r.sin, &r.cos);
+  } else if constexpr (std::same_as<T, long double>) {
+    __builtin_sincosl(x, &r.sin, &r.cos);
+  }
+#else
+  r.sin = real::sin(x);
+  r.cos = real::cos(x);
+#endif
+  return r;
+}
+
+/* sinh and cosh from a single expm1:
+ *   t = e^|x| - 1, u = e^|x|
+ *   sinh|x| = (t + t / u) / 2, cosh x = (u + 1 / u) / 2
+ * t keeps sinh accurate for small |x|. */
+template <floating_scalar T>
+constexpr sinhcosh_result<T> sinhcosh(T x) {
+  GSL_MATH_COUNT_CALL(sinhcosh);
+  const T ax = real::fabs(x);
+  const T t = real::expm1(ax);
+  const T u = t + 1;
+
+  if (real::isinf(u)) {
+    /* e^|x| overflows while cosh x = e^|x| / 2 may not, square e^(|x| / 2)
+     * in a safe order */
+    GSL_MATH_COUNT_PATH(sinhcosh, overflow);
+    const T h = real::exp(ax / 2);
+    const T r = h * (h / 2);
+    return {real::copysign(r, x), r};
+  }
+
+  return {real::copysign((t + t / u) / 2, x), (u + 1 / u) / 2};
+}
+
+/* Batch forms */
+
+template <floating_scalar T>
+void sincos(std::span<const T> x, std::span<T> s, std::span<T> c) {
+  const auto n = std::min({x.size(), s.size(), c.size()});
+  for (std::size_t i = 0; i < n; i++) {
+    const auto r = sincos(x[i]);
+    s[i] = r.sin;
+    c[i] = r.cos;
+  }
+}
+
+template <floating_scalar T>
+void sinhcosh(std::span<const T> x, std::span<T> sh, std::span<T> ch) {
+  const auto n = std::min({x.size(), sh.size(), ch.size()});
+  for (std::size_t i = 0; i < n; i++) {
+    const auto r = sinhcosh(x[i]);
+    sh[i] = r.sinh;
+    ch[i] = r.cosh;
+  }
+}
+
+}  // namespace gsl::math
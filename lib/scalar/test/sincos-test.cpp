@@ -0,0 +1,71 @@
+#include <gsl/math/sincos.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace {
+
+const double values[] = {0,   1e-300, 1.19209289550781250e-07, 1e-3, 0.5, 1,
+                         2,   3.14,   20,   100,  700,  710,  8.3886080e+06};
+
+bool near(double a, double b) {
+  return a == b || std::fabs(a - b) <= 1e-15 * std::fabs(b);
+}
+
+}  // namespace
+
+TEST(GSLMathSincos, SincosTest) {
+  for (const auto v : values) {
+    for (const auto x : {v, -v}) {
+      const auto r = gsl::math::sincos(x);
+      EXPECT_DOUBLE_EQ(r.sin, std::sin(x)) << x;
+      EXPECT_DOUBLE_EQ(r.cos, std::cos(x)) << x;
+
+      const auto f = gsl::math::sincos(static_cast<float>(x));
+      EXPECT_FLOAT_EQ(f.sin, std::sin(static_cast<float>(x))) << x;
+      EXPECT_FLOAT_EQ(f.cos, std::cos(static_cast<float>(x))) << x;
+    }
+  }
+}
+
+TEST(GSLMathSincos, SinhcoshTest) {
+  for (const auto v : values) {
+    for (const auto x : {v, -v}) {
+      const auto r = gsl::math::sinhcosh(x);
+      EXPECT_TRUE(near(r.sinh, std::sinh(x))) << x;
+      EXPECT_TRUE(near(r.cosh, std::cosh(x))) << x;
+      EXPECT_EQ(std::signbit(r.sinh), std::signbit(x)) << x;
+    }
+  }
+}
+
+TEST(GSLMathSincos, SinhcoshOverflowTest) {
+  constexpr auto inf = std::numeric_limits<double>::infinity();
+
+  /* e^710 overflows, cosh(710) does not */
+  const auto r = gsl::math::sinhcosh(710.0);
+  EXPECT_TRUE(std::isfinite(r.cosh));
+  EXPECT_TRUE(near(r.cosh, std::cosh(710.0)));
+
+  EXPECT_EQ(gsl::math::sinhcosh(1e4).cosh, inf);
+  EXPECT_EQ(gsl::math::sinhcosh(-1e4).sinh, -inf);
+}
+
+TEST(GSLMathSincos, BatchTest) {
+  std::vector<double> x(std::begin(values), std::end(values));
+  std::vector<double> s(x.size()), c(x.size());
+
+  gsl::math::sincos<double>(x, s, c);
+  for (size_t i = 0; i < x.size(); i++) {
+    EXPECT_EQ(s[i], gsl::math::sincos(x[i]).sin);
+    EXPECT_EQ(c[i], gsl::math::sincos(x[i]).cos);
+  }
+
+  gsl::math::sinhcosh<double>(x, s, c);
+  for (size_t i = 0; i < x.size(); i++) {
+    EXPECT_EQ(s[i], gsl::math::sinhcosh(x[i]).sinh);
+    EXPECT_EQ(c[i], gsl::math::sinhcosh(x[i]).cosh);
+  }
+}
@@ -21,6 +21,10 @@
 #pragma once
 
 #include <gsl/constant/math.h>
+#include <gsl/math/double_double.h>
+#include <gsl/math/half.h>
+#include <gsl/math/real.h>
+#include <gsl/math/sincos.h>
 
 #include <array>
 #include <cmath>
@@ -28,9 +32,16 @@
 #include <iostream>
 
 namespace gsl::type {
-/* two consecutive built-in types as a complex number */
+/* two consecutive real scalars as a complex number, the built-in floating
+ * point types or double_double, or the 16 bit storage types float16 and
+ * bfloat16 whose arithmetic is done in float */
 
-template <std::floating_point T>
+using gsl::math::bfloat16;
+using gsl::math::double_double;
+using gsl::math::float16;
+
+template <typename T>
+  requires gsl::math::floating_scalar<T> || gsl::math::storage_scalar<T>
 class complex_base {
  private:
   struct polar_t {};
@@ -38,6 +49,7 @@ class complex_base {
 
  public:
   using el_type = T;
+  using compute_type = gsl::math::compute_type<T>;
   using self_type = complex_base<el_type>;
   using packed_type = std::array<el_type, 2>;
   using const_packed_type = const packed_type;
@@ -51,18 +63,30 @@ class complex_base {
  public:
   constexpr complex_base() : data{0, 0} {}
   constexpr complex_base(polar_t, el_type mag, el_type rads)
-      : data{mag * cos(rads), mag * sin(rads)} {}
+      : complex_base(polar, mag, gsl::math::sincos(compute_type(rads))) {}
   constexpr complex_base(rect_t, el_type r, el_type i) : data{r, i} {}
   constexpr complex_base(el_type r, el_type i) : data{r, i} {}
   constexpr complex_base(rect_t, el_type r) : data{r, 0} {}
   constexpr complex_base(el_type r) : data{r, 0} {}
 
+  /* from another element type, rounded */
+  template <typename U>
+    requires(!std::same_as<U, T>)
+  constexpr explicit complex_base(const complex_base<U>& z)
+      : data{static_cast<el_type>(z.real()), static_cast<el_type>(z.img())} {}
+
+ private:
+  constexpr complex_base(polar_t, el_type mag,
+                         const gsl::math::sincos_result<compute_type>& sc)
+      : data{mag * sc.cos, mag * sc.sin} {}
+
+ public:
   constexpr el_type real() const { return std::get<0>(data); }
   constexpr el_type img() const { return std::get<1>(data); }
   constexpr el_type& real() { return std::get<0>(data); }
   constexpr el_type& img() { return std::get<1>(data); }
 
-  constexpr operator bool() const { return real() || img(); }
+  constexpr explicit operator bool() const { return real() || img(); }
 
   constexpr auto operator==(const self_type& rhs) const {
     return data == rhs.data;
@@ -75,24 +99,20 @@ class complex_base {
   constexpr el_type norm() const { return real() * real() + img() * img(); }
 
   constexpr el_type angle_in_rads() const {
-    const el_type eps = 1e-7;
-
-    if (dist() == 0) return 0;
+    if (real() == 0 && img() == 0) return 0;
 
-    return atan2(img(), real());
+    return gsl::math::real::atan2(img(), real());
   }
 
   constexpr el_type angle_in_rads2() const {
-    using gsl::constant::math::PI;
-
     auto rads = angle_in_rads();
     if (rads < 0) {
-      rads += 2 * PI;
+      rads += 2 * gsl::math::real::pi<el_type>;
     }
     return rads;
   }
 
-  constexpr el_type dist() const { return sqrt(norm()); }
+  constexpr el_type dist() const { return gsl::math::real::sqrt(norm()); }
 
   constexpr self_type congugate() const { return self_type{real(), -img()}; }
 
@@ -172,8 +192,11 @@ class complex_base {
   constexpr static self_type NEG_I{0, -1};
 };
 
+using complex_double_double = complex_base<double_double>;
 using complex_long_double = complex_base<long double>;
 using complex = complex_base<double>;
 using complex_float = complex_base<float>;
+using complex_float16 = complex_base<float16>;
+using complex_bfloat16 = complex_base<bfloat16>;
 
 }  // namespace gsl::type
\ No newline at end of file
@@ -0,0 +1,392 @@
+#pragma once
+
+#include <gsl/type/complex.h>
+#include <gsl/type/type_info.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <utility>
+
+namespace gsl::type {
+
+namespace expr {
+struct expr_base;
+}
+
+/* a sequence of complex numbers stored as two separate arrays (SoA), one for
+ * the real parts and one for the imaginary parts */
+
+/* Interleaved <-> split conversions */
+
+template <std::floating_point T>
+constexpr void deinterleave(std::span<const complex_base<T>> in,
+                            std::span<T> re, std::span<T> im) {
+  const auto n = std::min({in.size(), re.size(), im.size()});
+  for (std::size_t i = 0; i < n; i++) {
+    re[i] = in[i].real();
+    im[i] = in[i].img();
+  }
+}
+
+template <std::floating_point T>
+constexpr void interleave(std::span<const T> re, std::span<const T> im,
+                          std::span<complex_base<T>> out) {
+  const auto n = std::min({out.size(), re.size(), im.size()});
+  for (std::size_t i = 0; i < n; i++) {
+    out[i] = complex_base<T>{re[i], im[i]};
+  }
+}
+
+template <std::floating_point T>
+class complex_array {
+ public:
+  using el_type = T;
+  using value_type = complex_base<el_type>;
+  using self_type = complex_array<el_type>;
+  using size_type = std::size_t;
+
+  /* both buffers are aligned for the widest vector registers of the
+   * dispatched kernels so any variant can use aligned loads on them */
+  constexpr static size_type alignment =
+      simd_info<el_type, gsl::math::dispatch::widest>::alignment;
+
+  /* proxy to one element, behaves like a complex_base<T>& */
+  class reference {
+   public:
+    constexpr reference(el_type& r, el_type& i) : re{r}, im{i} {}
+    constexpr reference(const reference&) = default;
+
+    constexpr reference& operator=(const value_type& v) {
+      re = v.real();
+      im = v.img();
+      return *this;
+    }
+    constexpr reference& operator=(const reference& v) {
+      return *this = v.value();
+    }
+
+    constexpr operator value_type() const { return value(); }
+    constexpr value_type value() const { return value_type{re, im}; }
+
+    constexpr el_type real() const { return re; }
+    constexpr el_type img() const { return im; }
+    constexpr el_type& real() { return re; }
+    constexpr el_type& img() { return im; }
+
+    constexpr el_type norm() const { return value().norm(); }
+    constexpr el_type dist() const { return value().dist(); }
+    constexpr el_type angle_in_rads() const { return value().angle_in_rads(); }
+    constexpr el_type angle_in_rads2() const {
+      return value().angle_in_rads2();
+    }
+    constexpr value_type congugate() const { return value().congugate(); }
+    constexpr value_type inverse() const { return value().inverse(); }
+    constexpr value_type neg() const { return value().neg(); }
+
+    constexpr value_type operator-() const { return neg(); }
+    constexpr value_type operator+(const value_type& rhs) const {
+      return value() + rhs;
+    }
+    constexpr value_type operator-(const value_type& rhs) const {
+      return value() - rhs;
+    }
+    constexpr value_type operator*(const value_type& rhs) const {
+      return value() * rhs;
+    }
+    constexpr value_type operator/(const value_type& rhs) const {
+      return value() / rhs;
+    }
+
+    friend constexpr value_type operator+(el_type lhs, const reference& rhs) {
+      return lhs + rhs.value();
+    }
+    friend constexpr value_type operator-(el_type lhs, const reference& rhs) {
+      return lhs - rhs.value();
+    }
+    friend constexpr value_type operator*(el_type lhs, const reference& rhs) {
+      return lhs * rhs.value();
+    }
+    friend constexpr value_type operator/(el_type lhs, const reference& rhs) {
+      return lhs / rhs.value();
+    }
+
+    constexpr bool operator==(const value_type& rhs) const {
+      return value() == rhs;
+    }
+
+    friend auto& operator<<(std::ostream& out, const reference& v) {
+      return out << v.value();
+    }
+
+   private:
+    el_type& re;
+    el_type& im;
+  };
+
+  template <bool CONST>
+  class iterator_base {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = complex_array::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = std::conditional_t<CONST, value_type,
+                                         typename complex_array::reference>;
+    using ptr_type = std::conditional_t<CONST, const el_type*, el_type*>;
+
+    constexpr iterator_base() = default;
+    constexpr iterator_base(ptr_type r, ptr_type i) : re{r}, im{i} {}
+
+    constexpr reference operator*() const {
+      if constexpr (CONST) {
+        return value_type{*re, *im};
+      } else {
+        return reference{*re, *im};
+      }
+    }
+    constexpr reference operator[](difference_type n) const {
+      return *(*this + n);
+    }
+
+    constexpr iterator_base& operator++() {
+      ++re;
+      ++im;
+      return *this;
+    }
+    constexpr iterator_base operator++(int) {
+      auto t = *this;
+      ++*this;
+      return t;
+    }
+    constexpr iterator_base& operator--() {
+      --re;
+      --im;
+      return *this;
+    }
+    constexpr iterator_base operator--(int) {
+      auto t = *this;
+      --*this;
+      return t;
+    }
+    constexpr iterator_base& operator+=(difference_type n) {
+      re += n;
+      im += n;
+      return *this;
+    }
+    constexpr iterator_base& operator-=(difference_type n) {
+      return *this += -n;
+    }
+    constexpr iterator_base operator+(difference_type n) const {
+      auto t = *this;
+      return t += n;
+    }
+    friend constexpr iterator_base operator+(difference_type n,
+                                             const iterator_base& it) {
+      return it + n;
+    }
+    constexpr iterator_base operator-(difference_type n) const {
+      auto t = *this;
+      return t -= n;
+    }
+    constexpr difference_type operator-(const iterator_base& rhs) const {
+      return re - rhs.re;
+    }
+
+    constexpr bool operator==(const iterator_base& rhs) const {
+      return re == rhs.re;
+    }
+    constexpr auto operator<=>(const iterator_base& rhs) const {
+      return re <=> rhs.re;
+    }
+
+   private:
+    ptr_type re = nullptr;
+    ptr_type im = nullptr;
+  };
+
+  using iterator = iterator_base<false>;
+  using const_iterator = iterator_base<true>;
+
+ private:
+  struct aligned_delete {
+    void operator()(el_type* p) const {
+      ::operator delete[](p, std::align_val_t{alignment});
+    }
+  };
+  using buffer_type = std::unique_ptr<el_type[], aligned_delete>;
+
+  /* a byte count that would wrap is refused, as std::vector does */
+  static buffer_type allocate(size_type n) {
+    if (n == 0) return buffer_type{};
+    if (n > std::numeric_limits<size_type>::max() / sizeof(el_type)) {
+      throw std::length_error("complex_array: length");
+    }
+    auto* p = static_cast<el_type*>(
+        ::operator new[](n * sizeof(el_type), std::align_val_t{alignment}));
+    std::uninitialized_value_construct_n(p, n);
+    return buffer_type{p};
+  }
+
+  /* an expression of scalars only broadcasts, it has no size to take */
+  template <typename E>
+  static size_type sized_size(const E& e) {
+    static_assert(E::sized,
+                  "complex_array: the expression has no array or span operand");
+    return e.size();
+  }
+
+  size_type count = 0;
+  buffer_type re_buf;
+  buffer_type im_buf;
+
+ public:
+  complex_array() = default;
+  explicit complex_array(size_type n)
+      : count{n}, re_buf{allocate(n)}, im_buf{allocate(n)} {}
+  complex_array(size_type n, const value_type& v) : complex_array(n) {
+    fill(v);
+  }
+  explicit complex_array(std::span<const value_type> interleaved)
+      : complex_array(interleaved.size()) {
+    deinterleave(interleaved, reals(), imags());
+  }
+  complex_array(std::initializer_list<value_type> l)
+      : complex_array(std::span<const value_type>{l.begin(), l.size()}) {}
+
+  /* single pass evaluation of an expression of gsl/type/complex_expr.h, it
+   * needs at least one array or span operand to have a size */
+  template <std::derived_from<expr::expr_base> E>
+  complex_array(const E& e) : complex_array(sized_size(e)) {
+    evaluate(e);
+  }
+
+  complex_array(const self_type& rhs) : complex_array(rhs.count) {
+    std::copy_n(rhs.real_data(), count, real_data());
+    std::copy_n(rhs.img_data(), count, img_data());
+  }
+  complex_array(self_type&& rhs) noexcept
+      : count{std::exchange(rhs.count, 0)},
+        re_buf{std::move(rhs.re_buf)},
+        im_buf{std::move(rhs.im_buf)} {}
+
+  self_type& operator=(const self_type& rhs) {
+    if (this != &rhs) {
+      auto t = rhs;
+      swap(t);
+    }
+    return *this;
+  }
+  self_type& operator=(self_type&& rhs) noexcept {
+    auto t = std::move(rhs);
+    swap(t);
+    return *this;
+  }
+
+  template <std::derived_from<expr::expr_base> E>
+  self_type& operator=(const E& e) {
+    if (sized_size(e) == count) {
+      evaluate(e);
+    } else {
+      auto t = self_type(e);
+      swap(t);
+    }
+    return *this;
+  }
+
+  void swap(self_type& rhs) noexcept {
+    std::swap(count, rhs.count);
+    std::swap(re_buf, rhs.re_buf);
+    std::swap(im_buf, rhs.im_buf);
+  }
+
+  size_type size() const { return count; }
+  bool empty() const { return count == 0; }
+
+  /* raw split buffers, both aligned to `alignment` bytes */
+  el_type* real_data() { return std::assume_aligned<alignment>(re_buf.get()); }
+  el_type* img_data() { return std::assume_aligned<alignment>(im_buf.get()); }
+  const el_type* real_data() const {
+    return std::assume_aligned<alignment>(re_buf.get());
+  }
+  const el_type* img_data() const {
+    return std::assume_aligned<alignment>(im_buf.get());
+  }
+
+  std::span<el_type> reals() { return {real_data(), count}; }
+  std::span<el_type> imags() { return {img_data(), count}; }
+  std::span<const el_type> reals() const { return {real_data(), count}; }
+  std::span<const el_type> imags() const { return {img_data(), count}; }
+
+  reference operator[](size_type i) { return {re_buf[i], im_buf[i]}; }
+  value_type operator[](size_type i) const { return {re_buf[i], im_buf[i]}; }
+
+  reference at(size_type i) {
+    if (i >= count) throw std::out_of_range("complex_array::at");
+    return (*this)[i];
+  }
+  value_type at(size_type i) const {
+    if (i >= count) throw std::out_of_range("complex_array::at");
+    return (*this)[i];
+  }
+
+  iterator begin() { return {real_data(), img_data()}; }
+  iterator end() { return begin() + count; }
+  const_iterator begin() const { return {real_data(), img_data()}; }
+  const_iterator end() const { return begin() + count; }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  void fill(const value_type& v) {
+    std::fill_n(real_data(), count, v.real());
+    std::fill_n(img_data(), count, v.img());
+  }
+
+  /* copy from/to interleaved complex_base<T> storage */
+  void assign(std::span<const value_type> interleaved) {
+    if (interleaved.size() != count) {
+      *this = self_type(interleaved.size());
+    }
+    deinterleave(interleaved, reals(), imags());
+  }
+
+  void copy_to(std::span<value_type> interleaved) const {
+    interleave(reals(), imags(), interleaved);
+  }
+
+  bool operator==(const self_type& rhs) const {
+    return count == rhs.count &&
+           std::equal(real_data(), real_data() + count, rhs.real_data()) &&
+           std::equal(img_data(), img_data() + count, rhs.img_data());
+  }
+
+ private:
+  template <typename E>
+  void evaluate(const E& e) {
+    auto* re = real_data();
+    auto* im = img_data();
+    for (size_type i = 0; i < count; i++) {
+      const value_type v = e[i];
+      re[i] = v.real();
+      im[i] = v.img();
+    }
+  }
+};
+
+template <std::floating_point T>
+void swap(complex_array<T>& lhs, complex_array<T>& rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+using complex_array_long_double = complex_array<long double>;
+using complex_array_double = complex_array<double>;
+using complex_array_float = complex_array<float>;
+
+}  // namespace gsl::type
@@ -0,0 +1,373 @@
+#pragma once
+
+#include <gsl/type/complex.h>
+#include <gsl/type/complex_array.h>
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+namespace gsl::type::expr {
+/* Opt-in expression templates for complex arithmetic
+ *
+ * The operators of this namespace do not compute anything, they build a
+ * tree of the operation that is evaluated element by element when it is
+ * assigned. A whole chain of + - * / and conj() over complex_array,
+ * std::span<const complex_base<T>>, complex_base<T> and T operands is then a
+ * single pass over the data with no intermediate arrays:
+ *
+ *   using namespace gsl::type::expr;
+ *   y = a * x + b * conj(x);             // y, x complex_array<T>
+ *   assign(out, lazy(in) * w - 1.0);     // spans of complex_base<T>
+ *   auto z = evaluate(lazy(u) / v + w);  // complex_base<T> values
+ *
+ * Operands of complex_array type need either the using directive or lazy().
+ * A tree only refers to the arrays and spans it was built from, it must not
+ * outlive them. Element i of the result only reads element i of every
+ * operand, so the target may also appear in the expression.
+ *
+ * The array and span operands of a tree must all have the same size, a
+ * node of two of different sizes throws std::invalid_argument. A tree is
+ * sized when it has at least one of them; only a sized tree can become a
+ * complex_array, one of scalars only is a value of evaluate(). */
+
+struct expr_base {};
+
+template <typename E>
+concept expression = std::derived_from<E, expr_base>;
+
+/* size of an operand that broadcasts a single value, its sized is false */
+constexpr std::size_t broadcast = std::numeric_limits<std::size_t>::max();
+
+/* Leaves */
+
+template <std::floating_point T>
+class value_leaf : public expr_base {
+ public:
+  using el_type = T;
+
+  static constexpr bool sized = false;
+
+  constexpr explicit value_leaf(const complex_base<T>& v) : v{v} {}
+
+  constexpr std::size_t size() const { return broadcast; }
+  constexpr complex_base<T> operator[](std::size_t) const { return v; }
+
+ private:
+  complex_base<T> v;
+};
+
+/* a real scalar, kept real so mixed operations skip the zero imaginary part */
+template <std::floating_point T>
+class real_leaf : public expr_base {
+ public:
+  using el_type = T;
+
+  static constexpr bool sized = false;
+
+  constexpr explicit real_leaf(T v) : v{v} {}
+
+  constexpr std::size_t size() const { return broadcast; }
+  constexpr T operator[](std::size_t) const { return v; }
+
+ private:
+  T v;
+};
+
+template <std::floating_point T>
+class array_leaf : public expr_base {
+ public:
+  using el_type = T;
+
+  static constexpr bool sized = true;
+
+  constexpr explicit array_leaf(const complex_array<T>& a)
+      : re{a.real_data()}, im{a.img_data()}, n{a.size()} {}
+
+  constexpr std::size_t size() const { return n; }
+  constexpr complex_base<T> operator[](std::size_t i) const {
+    return {re[i], im[i]};
+  }
+
+ private:
+  const T* re;
+  const T* im;
+  std::size_t n;
+};
+
+template <std::floating_point T>
+class span_leaf : public expr_base {
+ public:
+  using el_type = T;
+
+  static constexpr bool sized = true;
+
+  constexpr explicit span_leaf(std::span<const complex_base<T>> s) : s{s} {}
+
+  constexpr std::size_t size() const { return s.size(); }
+  constexpr complex_base<T> operator[](std::size_t i) const { return s[i]; }
+
+ private:
+  std::span<const complex_base<T>> s;
+};
+
+template <std::floating_point T>
+constexpr auto lazy(const complex_base<T>& v) {
+  return value_leaf<T>{v};
+}
+
+template <std::floating_point T>
+constexpr auto lazy(const complex_array<T>& a) {
+  return array_leaf<T>{a};
+}
+
+template <std::floating_point T>
+constexpr auto lazy(std::span<const complex_base<T>> s) {
+  return span_leaf<T>{s};
+}
+
+template <std::floating_point T>
+constexpr auto lazy(std::span<complex_base<T>> s) {
+  return span_leaf<T>{s};
+}
+
+/* Element operations, the real overloads avoid the products with a zero
+ * imaginary part and div does not go through inverse() */
+
+struct add {
+  template <typename A, typename B>
+  constexpr auto operator()(const A& a, const B& b) const {
+    return a + b;
+  }
+};
+
+struct sub {
+  template <typename A, typename B>
+  constexpr auto operator()(const A& a, const B& b) const {
+    return a - b;
+  }
+};
+
+struct mul {
+  template <typename A, typename B>
+  constexpr auto operator()(const A& a, const B& b) const {
+    return a * b;
+  }
+};
+
+struct div {
+  template <std::floating_point T>
+  constexpr auto operator()(const complex_base<T>& a,
+                            const complex_base<T>& b) const {
+    const T d = 1 / b.norm();
+    return complex_base<T>{(a.real() * b.real() + a.img() * b.img()) * d,
+                           (a.img() * b.real() - a.real() * b.img()) * d};
+  }
+  template <std::floating_point T>
+  constexpr auto operator()(T a, const complex_base<T>& b) const {
+    const T d = a / b.norm();
+    return complex_base<T>{b.real() * d, -b.img() * d};
+  }
+  template <std::floating_point T>
+  constexpr auto operator()(const complex_base<T>& a, T b) const {
+    return a / b;
+  }
+};
+
+struct neg {
+  template <std::floating_point T>
+  constexpr auto operator()(const complex_base<T>& a) const {
+    return -a;
+  }
+};
+
+struct conjugate {
+  template <std::floating_point T>
+  constexpr auto operator()(const complex_base<T>& a) const {
+    return a.congugate();
+  }
+};
+
+/* Nodes */
+
+template <typename Op, expression E>
+class unary : public expr_base {
+ public:
+  using el_type = typename E::el_type;
+
+  static constexpr bool sized = E::sized;
+
+  constexpr explicit unary(const E& e) : e{e} {}
+
+  constexpr std::size_t size() const { return e.size(); }
+  constexpr complex_base<el_type> operator[](std::size_t i) const {
+    return Op{}(e[i]);
+  }
+
+ private:
+  E e;
+};
+
+template <typename Op, expression L, expression R>
+class binary : public expr_base {
+ public:
+  using el_type = typename L::el_type;
+
+  static constexpr bool sized = L::sized || R::sized;
+
+  constexpr binary(const L& l, const R& r) : l{l}, r{r} {
+    if constexpr (L::sized && R::sized) {
+      if (l.size() != r.size()) {
+        throw std::invalid_argument("gsl::type::expr: operand sizes differ");
+      }
+    }
+  }
+
+  /* the size of the sized side, broadcast when neither is */
+  constexpr std::size_t size() const {
+    if constexpr (L::sized) {
+      return l.size();
+    } else {
+      return r.size();
+    }
+  }
+  constexpr complex_base<el_type> operator[](std::size_t i) const {
+    return Op{}(l[i], r[i]);
+  }
+
+ private:
+  L l;
+  R r;
+};
+
+/* Operands */
+
+namespace detail {
+
+template <typename X>
+struct operand {
+  using el_type = void;
+};
+
+template <expression E>
+struct operand<E> {
+  using el_type = typename E::el_type;
+};
+
+template <std::floating_point T>
+struct operand<complex_array<T>> {
+  using el_type = T;
+};
+
+template <std::floating_point T>
+struct operand<complex_base<T>> {
+  using el_type = T;
+};
+
+template <typename X>
+constexpr bool is_array = false;
+
+template <std::floating_point T>
+constexpr bool is_array<complex_array<T>> = true;
+
+template <typename X>
+concept node_like = expression<X> || is_array<X>;
+
+template <typename X>
+concept scalar = std::is_arithmetic_v<X>;
+
+/* the element type shared by both sides, one of them may be a bare scalar */
+template <typename L, typename R>
+using el_type_of = std::conditional_t<
+    std::is_void_v<typename operand<L>::el_type>, typename operand<R>::el_type,
+    typename operand<L>::el_type>;
+
+template <typename L, typename R>
+concept operands =
+    (node_like<L> || node_like<R>) &&
+    (scalar<L> || scalar<R> ||
+     std::same_as<typename operand<L>::el_type, typename operand<R>::el_type>);
+
+template <typename T, typename X>
+constexpr auto leaf(const X& x) {
+  if constexpr (expression<X>) {
+    return x;
+  } else if constexpr (scalar<X>) {
+    return real_leaf<T>{static_cast<T>(x)};
+  } else {
+    return lazy(x);
+  }
+}
+
+template <typename Op, typename L, typename R>
+constexpr auto make_binary(const L& l, const R& r) {
+  using T = el_type_of<L, R>;
+  using LL = decltype(leaf<T>(l));
+  using RR = decltype(leaf<T>(r));
+  return binary<Op, LL, RR>{leaf<T>(l), leaf<T>(r)};
+}
+
+}  // namespace detail
+
+template <typename L, typename R>
+  requires detail::operands<L, R>
+constexpr auto operator+(const L& l, const R& r) {
+  return detail::make_binary<add>(l, r);
+}
+
+template <typename L, typename R>
+  requires detail::operands<L, R>
+constexpr auto operator-(const L& l, const R& r) {
+  return detail::make_binary<sub>(l, r);
+}
+
+template <typename L, typename R>
+  requires detail::operands<L, R>
+constexpr auto operator*(const L& l, const R& r) {
+  return detail::make_binary<mul>(l, r);
+}
+
+template <typename L, typename R>
+  requires detail::operands<L, R>
+constexpr auto operator/(const L& l, const R& r) {
+  return detail::make_binary<div>(l, r);
+}
+
+template <detail::node_like E>
+constexpr auto operator-(const E& e) {
+  using T = typename detail::operand<E>::el_type;
+  using EE = decltype(detail::leaf<T>(e));
+  return unary<neg, EE>{detail::leaf<T>(e)};
+}
+
+template <detail::node_like E>
+constexpr auto conj(const E& e) {
+  using T = typename detail::operand<E>::el_type;
+  using EE = decltype(detail::leaf<T>(e));
+  return unary<conjugate, EE>{detail::leaf<T>(e)};
+}
+
+/* Evaluation */
+
+/* value of an expression made only of broadcast operands */
+template <expression E>
+constexpr auto evaluate(const E& e) {
+  static_assert(!E::sized, "gsl::type::expr::evaluate: a sized expression");
+  return complex_base<typename E::el_type>{e[0]};
+}
+
+/* out[i] = e[i] for i < min(out.size(), e.size()) */
+template <expression E>
+constexpr void assign(std::span<complex_base<typename E::el_type>> out,
+                      const E& e) {
+  const auto n = std::min(out.size(), e.size());
+  for (std::size_t i = 0; i < n; i++) {
+    out[i] = e[i];
+  }
+}
+
+}  // namespace gsl::type::expr
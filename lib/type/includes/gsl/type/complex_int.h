@@ -0,0 +1,331 @@
+#pragma once
+
+#include <gsl/math/fixed.h>
+#include <gsl/type/complex.h>
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <span>
+
+namespace gsl::type {
+
+/* Integer and fixed point complex numbers
+ *
+ * complex_int<T> holds interleaved (real, imag) pairs of a signed integer
+ * or a gsl::math::fixed scalar, the layout of the IQ samples delivered by
+ * radio front ends. The arithmetic saturates instead of wrapping:
+ *
+ *   + - and negation   clamp each part to the range of T
+ *   *                  the exact product of the parts in the wider type,
+ *                      rounded back to the fraction bits of T (fixed point)
+ *                      and clamped
+ *   mul_wide           the product in the wider type (int16 -> int32,
+ *                      q15 -> fixed<int32_t, 30>), exact but for the one
+ *                      corner (min, min) * (min, min) whose imaginary part
+ *                      2 * min^2 is clamped
+ *
+ * The span functions at the end convert whole buffers to and from
+ * complex_float and add, subtract and multiply them. They are plain loops
+ * over the interleaved scalars written so the compiler vectorizes them in
+ * the lanes of T (paddsw, cvtdq2ps, packssdw, ...); the multiplies need
+ * the 32 bit lane multiply of SSE4.1 or AVX2 to pay off. */
+
+using gsl::math::q15;
+using gsl::math::q31;
+using gsl::math::q7;
+
+template <typename T>
+concept integer_scalar =
+    std::signed_integral<T> || gsl::math::fixed_scalar<T>;
+
+namespace detail {
+namespace fx = gsl::math::detail::fixed;
+}
+
+namespace detail::integer {
+
+/* the raw integer of an element type, its fraction bits and the type of
+ * the exact products */
+template <typename T>
+struct element {
+  using raw_type = T;
+  static constexpr int fraction_bits = 0;
+
+  static constexpr T bits(T x) { return x; }
+  static constexpr T make(T r) { return r; }
+};
+
+template <std::signed_integral Raw, int F>
+struct element<gsl::math::fixed<Raw, F>> {
+  using raw_type = Raw;
+  static constexpr int fraction_bits = F;
+
+  static constexpr Raw bits(gsl::math::fixed<Raw, F> x) { return x.bits(); }
+  static constexpr auto make(Raw r) {
+    return gsl::math::fixed<Raw, F>::from_bits(r);
+  }
+};
+
+template <typename T>
+using raw_t = typename element<T>::raw_type;
+
+template <typename T>
+struct wide {
+  using type = detail::fx::wider_t<T>;
+};
+
+template <std::signed_integral Raw, int F>
+struct wide<gsl::math::fixed<Raw, F>> {
+  using type = gsl::math::fixed<detail::fx::wider_t<Raw>, 2 * F>;
+};
+
+template <typename T>
+concept widenable = detail::fx::widenable<raw_t<T>>;
+
+/* the value of one unit of the raw integer */
+template <typename T>
+constexpr float unit = 1 / detail::fx::scale<element<T>::fraction_bits>;
+
+}  // namespace detail::integer
+
+/* the element type of mul_wide */
+template <integer_scalar T>
+  requires detail::integer::widenable<T>
+using wide_type = typename detail::integer::wide<T>::type;
+
+template <integer_scalar T>
+class complex_int {
+ private:
+  using element = detail::integer::element<T>;
+
+ public:
+  using el_type = T;
+  using raw_type = detail::integer::raw_t<T>;
+  using self_type = complex_int<el_type>;
+  using packed_type = std::array<el_type, 2>;
+
+  static constexpr int fraction_bits = element::fraction_bits;
+
+ private:
+  packed_type data;
+
+ public:
+  constexpr complex_int() : data{} {}
+  constexpr complex_int(el_type r, el_type i) : data{r, i} {}
+  constexpr explicit complex_int(el_type r) : data{r, el_type{}} {}
+
+  /* from float, scaled by 2^fraction_bits, rounded to nearest even and
+   * clamped, nan gives 0 */
+  constexpr explicit complex_int(const complex_float& z)
+      : data{element::make(from_float(z.real())),
+             element::make(from_float(z.img()))} {}
+
+  constexpr explicit operator complex_float() const {
+    return {to_float(real()), to_float(img())};
+  }
+
+  static constexpr self_type from_bits(raw_type r, raw_type i) {
+    return {element::make(r), element::make(i)};
+  }
+
+  constexpr el_type real() const { return std::get<0>(data); }
+  constexpr el_type img() const { return std::get<1>(data); }
+  constexpr el_type& real() { return std::get<0>(data); }
+  constexpr el_type& img() { return std::get<1>(data); }
+
+  constexpr raw_type real_bits() const { return element::bits(real()); }
+  constexpr raw_type img_bits() const { return element::bits(img()); }
+
+  constexpr bool operator==(const self_type& rhs) const = default;
+
+  constexpr self_type conjugate() const {
+    return from_bits(real_bits(),
+                     detail::fx::sub_sat(raw_type{0}, img_bits()));
+  }
+
+  constexpr self_type operator-() const {
+    return from_bits(detail::fx::sub_sat(raw_type{0}, real_bits()),
+                     detail::fx::sub_sat(raw_type{0}, img_bits()));
+  }
+
+  constexpr self_type operator+(const self_type& rhs) const {
+    return from_bits(detail::fx::add_sat(real_bits(), rhs.real_bits()),
+                     detail::fx::add_sat(img_bits(), rhs.img_bits()));
+  }
+
+  constexpr self_type operator-(const self_type& rhs) const {
+    return from_bits(detail::fx::sub_sat(real_bits(), rhs.real_bits()),
+                     detail::fx::sub_sat(img_bits(), rhs.img_bits()));
+  }
+
+  constexpr self_type operator*(const self_type& rhs) const
+    requires detail::integer::widenable<T>
+  {
+    const auto p = products(*this, rhs);
+    return from_bits(narrow(p.real), narrow(p.img));
+  }
+
+  constexpr self_type& operator+=(const self_type& rhs) {
+    return *this = *this + rhs;
+  }
+  constexpr self_type& operator-=(const self_type& rhs) {
+    return *this = *this - rhs;
+  }
+  constexpr self_type& operator*=(const self_type& rhs)
+    requires detail::integer::widenable<T>
+  {
+    return *this = *this * rhs;
+  }
+
+  /* exact in the wider type, see the header comment */
+  friend constexpr complex_int<wide_type<T>> mul_wide(const self_type& a,
+                                                      const self_type& b)
+    requires detail::integer::widenable<T>
+  {
+    const auto p = products(a, b);
+    return complex_int<wide_type<T>>::from_bits(p.real, p.img);
+  }
+
+  friend auto& operator<<(std::ostream& out, const self_type& v) {
+    out << '(' << +v.real_bits() << ',' << +v.img_bits() << ')';
+    return out;
+  }
+
+ private:
+  static constexpr raw_type from_float(float x) {
+    return detail::fx::from_float<raw_type>(
+        x * detail::fx::scale<fraction_bits>);
+  }
+
+  static constexpr float to_float(el_type x) {
+    return static_cast<float>(element::bits(x)) *
+           detail::integer::unit<el_type>;
+  }
+
+  /* the sums of the exact part products, with 2 * fraction_bits fraction
+   * bits; only 2 * min^2 is clamped */
+  template <typename W>
+  struct wide_parts {
+    W real;
+    W img;
+  };
+
+  static constexpr auto products(const self_type& a, const self_type& b) {
+    using W = detail::fx::wider_t<raw_type>;
+    const W ar = a.real_bits(), ai = a.img_bits();
+    const W br = b.real_bits(), bi = b.img_bits();
+    return wide_parts<W>{
+        detail::fx::sub_sat(static_cast<W>(ar * br), static_cast<W>(ai * bi)),
+        detail::fx::add_sat(static_cast<W>(ar * bi), static_cast<W>(ai * br))};
+  }
+
+  template <typename W>
+  static constexpr raw_type narrow(W x) {
+    return detail::fx::saturate<raw_type>(
+        detail::fx::round_shift<fraction_bits>(x));
+  }
+};
+
+using complex_int8 = complex_int<std::int8_t>;
+using complex_int16 = complex_int<std::int16_t>;
+using complex_int32 = complex_int<std::int32_t>;
+using complex_q7 = complex_int<q7>;
+using complex_q15 = complex_int<q15>;
+using complex_q31 = complex_int<q31>;
+
+static_assert(sizeof(complex_int8) == 2 && sizeof(complex_int16) == 4);
+static_assert(sizeof(complex_q15) == 4 && sizeof(complex_q31) == 8);
+
+/* Span forms
+ *
+ * They process min() of the span sizes elements and take the element type
+ * explicitly, convert<std::int16_t>(iq, out). scale multiplies the values
+ * on the float side: a sample converts to its value (the raw integer times
+ * 2^-fraction_bits) times scale, a float converts from x / scale. */
+
+namespace detail::integer {
+
+template <typename T>
+const raw_t<T>* raw(std::span<const complex_int<T>> v) {
+  return reinterpret_cast<const raw_t<T>*>(v.data());
+}
+
+template <typename T>
+raw_t<T>* raw(std::span<complex_int<T>> v) {
+  return reinterpret_cast<raw_t<T>*>(v.data());
+}
+
+}  // namespace detail::integer
+
+template <integer_scalar T>
+void convert(std::span<const complex_int<T>> in,
+             std::span<complex_float> out, float scale = 1) {
+  const auto n = 2 * std::min(in.size(), out.size());
+  const auto* x = detail::integer::raw<T>(in);
+  auto* y = reinterpret_cast<float*>(out.data());
+  const float s = scale * detail::integer::unit<T>;
+  for (std::size_t i = 0; i < n; i++) {
+    y[i] = static_cast<float>(x[i]) * s;
+  }
+}
+
+template <integer_scalar T>
+void convert(std::span<const complex_float> in,
+             std::span<complex_int<T>> out, float scale = 1) {
+  using R = detail::integer::raw_t<T>;
+  const auto n = 2 * std::min(in.size(), out.size());
+  const auto* x = reinterpret_cast<const float*>(in.data());
+  auto* y = detail::integer::raw<T>(out);
+  const float s =
+      detail::fx::scale<detail::integer::element<T>::fraction_bits> / scale;
+  for (std::size_t i = 0; i < n; i++) {
+    y[i] = detail::fx::from_float<R>(x[i] * s);
+  }
+}
+
+template <integer_scalar T>
+void add(std::span<const complex_int<T>> a, std::span<const complex_int<T>> b,
+         std::span<complex_int<T>> out) {
+  const auto n = 2 * std::min({a.size(), b.size(), out.size()});
+  const auto* x = detail::integer::raw<T>(a);
+  const auto* y = detail::integer::raw<T>(b);
+  auto* z = detail::integer::raw<T>(out);
+  for (std::size_t i = 0; i < n; i++) {
+    z[i] = detail::fx::add_sat(x[i], y[i]);
+  }
+}
+
+template <integer_scalar T>
+void sub(std::span<const complex_int<T>> a, std::span<const complex_int<T>> b,
+         std::span<complex_int<T>> out) {
+  const auto n = 2 * std::min({a.size(), b.size(), out.size()});
+  const auto* x = detail::integer::raw<T>(a);
+  const auto* y = detail::integer::raw<T>(b);
+  auto* z = detail::integer::raw<T>(out);
+  for (std::size_t i = 0; i < n; i++) {
+    z[i] = detail::fx::sub_sat(x[i], y[i]);
+  }
+}
+
+template <integer_scalar T>
+  requires detail::integer::widenable<T>
+void mul(std::span<const complex_int<T>> a, std::span<const complex_int<T>> b,
+         std::span<complex_int<T>> out) {
+  const auto n = std::min({a.size(), b.size(), out.size()});
+  for (std::size_t i = 0; i < n; i++) out[i] = a[i] * b[i];
+}
+
+template <integer_scalar T>
+  requires detail::integer::widenable<T>
+void mul_wide(std::span<const complex_int<T>> a,
+              std::span<const complex_int<T>> b,
+              std::span<complex_int<wide_type<T>>> out) {
+  const auto n = std::min({a.size(), b.size(), out.size()});
+  for (std::size_t i = 0; i < n; i++) out[i] = mul_wide(a[i], b[i]);
+}
+
+}  // namespace gsl::type
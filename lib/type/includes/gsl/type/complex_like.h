@@ -0,0 +1,116 @@
+#pragma once
+
+#include <gsl/type/complex.h>
+
+#include <complex>
+#include <concepts>
+#include <type_traits>
+
+namespace gsl::type {
+
+/* Complex types the gsl::math functions take as they are
+ *
+ * complex_traits<Z> says how to read the real and imaginary part of a Z
+ * and how to build the result of a function of a Z. It is defined for
+ *
+ *   complex_base<T>        the result is a complex_base<T>
+ *   std::complex<T>        the result is a std::complex<T>
+ *   element proxies        types with real(), img() and a value() that
+ *                          gives the complex_base<T> they stand for, the
+ *                          complex_array<T> elements; the result is the
+ *                          complex_base<T>
+ *
+ * and can be specialized for other types. complex_like<Z> holds for the
+ * types it is defined for; the gsl::math functions deduce T from them
+ * instead of taking it as a template argument, see the end of
+ * gsl/math/complex.h. */
+
+template <typename Z>
+struct complex_traits {};
+
+template <typename T>
+struct complex_traits<complex_base<T>> {
+  using value_type = T;
+  using result_type = complex_base<T>;
+
+  static constexpr T real(const complex_base<T>& z) { return z.real(); }
+  static constexpr T img(const complex_base<T>& z) { return z.img(); }
+  static constexpr result_type make(T r, T i) { return {r, i}; }
+};
+
+template <std::floating_point T>
+struct complex_traits<std::complex<T>> {
+  using value_type = T;
+  using result_type = std::complex<T>;
+
+  static constexpr T real(const std::complex<T>& z) { return z.real(); }
+  static constexpr T img(const std::complex<T>& z) { return z.imag(); }
+  static constexpr result_type make(T r, T i) { return {r, i}; }
+};
+
+namespace detail {
+
+template <typename V>
+struct is_complex_base : std::false_type {};
+template <typename T>
+struct is_complex_base<complex_base<T>> : std::true_type {};
+
+template <typename Z>
+concept element_proxy = requires(const Z& z) {
+  requires is_complex_base<std::remove_cvref_t<decltype(z.value())>>::value;
+  { z.real() } -> std::convertible_to<typename decltype(z.value())::el_type>;
+  { z.img() } -> std::convertible_to<typename decltype(z.value())::el_type>;
+};
+
+}  // namespace detail
+
+template <detail::element_proxy Z>
+struct complex_traits<Z> {
+  using result_type = std::remove_cvref_t<decltype(std::declval<Z>().value())>;
+  using value_type = typename result_type::el_type;
+
+  static constexpr value_type real(const Z& z) { return z.real(); }
+  static constexpr value_type img(const Z& z) { return z.img(); }
+  static constexpr result_type make(value_type r, value_type i) {
+    return {r, i};
+  }
+};
+
+template <typename Z>
+concept complex_like = requires {
+  typename complex_traits<std::remove_cvref_t<Z>>::value_type;
+};
+
+template <complex_like Z>
+using complex_value_t =
+    typename complex_traits<std::remove_cvref_t<Z>>::value_type;
+
+template <complex_like Z>
+using complex_result_t =
+    typename complex_traits<std::remove_cvref_t<Z>>::result_type;
+
+/* z as a complex_base, by reference when it is one */
+template <complex_like Z>
+constexpr decltype(auto) as_complex_base(const Z& z) {
+  using T = complex_value_t<Z>;
+  if constexpr (std::same_as<Z, complex_base<T>>) {
+    return (z);
+  } else {
+    using traits = complex_traits<std::remove_cvref_t<Z>>;
+    return complex_base<T>{traits::real(z), traits::img(z)};
+  }
+}
+
+/* the result of a function of a Z: complex_base results in the type of
+ * complex_traits<Z>, real ones as they are */
+template <complex_like Z, typename R>
+constexpr auto as_complex_result(const R& r) {
+  if constexpr (std::same_as<R, complex_base<complex_value_t<Z>>> &&
+                !std::same_as<complex_result_t<Z>, R>) {
+    return complex_traits<std::remove_cvref_t<Z>>::make(r.real(), r.img());
+  } else {
+    return r;
+  }
+}
+
+}  // namespace gsl::type
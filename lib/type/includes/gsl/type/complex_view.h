@@ -0,0 +1,203 @@
+#pragma once
+
+#include <gsl/type/complex.h>
+
+#include <complex>
+#include <concepts>
+#include <cstddef>
+#include <ranges>
+#include <span>
+#include <type_traits>
+
+namespace gsl::type {
+
+/* Views of foreign complex buffers
+ *
+ * complex_base<T> of float, double and long double has the layout of
+ * std::complex<T>, of C99 T _Complex and of a (real, imag) pair in an
+ * interleaved T array, the asserts below check it. The functions here
+ * take a buffer of one as a span of the other without copying anything,
+ * so the span functions of gsl::math run on the storage of other
+ * libraries and write their results straight into it:
+ *
+ *   as_complex(r)        range of std::complex<T> or T _Complex
+ *                        -> span of complex_base<T>
+ *   as_complex(p, n)     the same from a pointer to n elements, or to n
+ *                        (real, imag) pairs of an interleaved T array
+ *   as_std_complex(r)    range of complex_base<T> -> span of std::complex<T>
+ *   as_c_complex(r)      range of complex_base<T> -> span of T _Complex
+ *   as_interleaved(r)    range of complex_base<T> -> span of its 2 n scalars
+ *
+ * The ranges are contiguous ones whose storage outlives the call (vectors,
+ * arrays, spans); a range of const elements gives a span of const elements.
+ * The views alias the buffer and are valid as long as it is. The batch
+ * functions of gsl::math access the elements only through T pointers, the
+ * array access std::complex and _Complex guarantee. T _Complex is the GNU
+ * extension of C++ compilers for the C99 type and only declared there. */
+
+#if defined(__GNUC__)
+#define GSL_TYPE_C_COMPLEX 1
+#else
+#define GSL_TYPE_C_COMPLEX 0
+#endif
+
+namespace detail::view {
+
+/* the C99 complex type of a scalar, the extension does not take a template
+ * parameter */
+template <typename T>
+struct c_complex {};
+
+#if GSL_TYPE_C_COMPLEX
+template <>
+struct c_complex<float> {
+  __extension__ typedef _Complex float type;
+};
+template <>
+struct c_complex<double> {
+  __extension__ typedef _Complex double type;
+};
+template <>
+struct c_complex<long double> {
+  __extension__ typedef _Complex long double type;
+};
+#endif
+
+/* the scalar of a complex element type that shares the layout of
+ * complex_base, an interleaved array is an array of its scalar */
+template <typename E>
+struct scalar_of {};
+
+template <std::floating_point T>
+struct scalar_of<T> {
+  using type = T;
+};
+
+template <std::floating_point T>
+struct scalar_of<std::complex<T>> {
+  using type = T;
+};
+
+template <std::floating_point T>
+struct scalar_of<complex_base<T>> {
+  using type = T;
+};
+
+#if GSL_TYPE_C_COMPLEX
+template <>
+struct scalar_of<c_complex<float>::type> {
+  using type = float;
+};
+template <>
+struct scalar_of<c_complex<double>::type> {
+  using type = double;
+};
+template <>
+struct scalar_of<c_complex<long double>::type> {
+  using type = long double;
+};
+#endif
+
+template <typename E>
+using scalar_t = typename scalar_of<std::remove_const_t<E>>::type;
+
+/* To with the constness of E */
+template <typename E, typename To>
+using like = std::conditional_t<std::is_const_v<E>, const To, To>;
+
+template <typename E>
+concept element = requires { typename scalar_t<E>; };
+
+template <typename E>
+concept foreign = element<E> && !std::floating_point<std::remove_const_t<E>> &&
+                  !std::same_as<std::remove_const_t<E>,
+                                complex_base<scalar_t<E>>>;
+
+template <typename E>
+concept native =
+    element<E> &&
+    std::same_as<std::remove_const_t<E>, complex_base<scalar_t<E>>>;
+
+template <typename R>
+using element_t = std::remove_reference_t<std::ranges::range_reference_t<R>>;
+
+template <typename R>
+concept buffer = std::ranges::contiguous_range<R> &&
+                 std::ranges::sized_range<R> &&
+                 std::ranges::borrowed_range<R>;
+
+template <typename To, typename E>
+std::span<like<E, To>> cast(E* p, std::size_t n) {
+  return {reinterpret_cast<like<E, To>*>(p), n};
+}
+
+template <typename T>
+constexpr bool same_layout(std::size_t size, std::size_t align) {
+  return sizeof(complex_base<T>) == size && alignof(complex_base<T>) == align;
+}
+
+template <typename T>
+constexpr bool check() {
+  static_assert(std::is_standard_layout_v<complex_base<T>> &&
+                std::is_trivially_copyable_v<complex_base<T>>);
+  static_assert(same_layout<T>(2 * sizeof(T), alignof(T)));
+  static_assert(
+      same_layout<T>(sizeof(std::complex<T>), alignof(std::complex<T>)));
+#if GSL_TYPE_C_COMPLEX
+  using C = typename c_complex<T>::type;
+  static_assert(same_layout<T>(sizeof(C), alignof(C)));
+#endif
+  return true;
+}
+
+static_assert(check<float>() && check<double>() && check<long double>());
+
+}  // namespace detail::view
+
+#if GSL_TYPE_C_COMPLEX
+template <std::floating_point T>
+using c_complex_t = typename detail::view::c_complex<T>::type;
+#endif
+
+template <detail::view::buffer R>
+  requires detail::view::foreign<detail::view::element_t<R>>
+auto as_complex(R&& r) {
+  using E = detail::view::element_t<R>;
+  return detail::view::cast<complex_base<detail::view::scalar_t<E>>>(
+      std::ranges::data(r), std::ranges::size(r));
+}
+
+/* n elements of E, n pairs for an interleaved array of scalars */
+template <detail::view::element E>
+  requires(!detail::view::native<E>)
+auto as_complex(E* p, std::size_t n) {
+  return detail::view::cast<complex_base<detail::view::scalar_t<E>>>(p, n);
+}
+
+template <detail::view::buffer R>
+  requires detail::view::native<detail::view::element_t<R>>
+auto as_std_complex(R&& r) {
+  using E = detail::view::element_t<R>;
+  return detail::view::cast<std::complex<detail::view::scalar_t<E>>>(
+      std::ranges::data(r), std::ranges::size(r));
+}
+
+#if GSL_TYPE_C_COMPLEX
+template <detail::view::buffer R>
+  requires detail::view::native<detail::view::element_t<R>>
+auto as_c_complex(R&& r) {
+  using E = detail::view::element_t<R>;
+  using C = c_complex_t<detail::view::scalar_t<E>>;
+  return detail::view::cast<C>(std::ranges::data(r), std::ranges::size(r));
+}
+#endif
+
+template <detail::view::buffer R>
+  requires detail::view::native<detail::view::element_t<R>>
+auto as_interleaved(R&& r) {
+  using E = detail::view::element_t<R>;
+  return detail::view::cast<detail::view::scalar_t<E>>(
+      std::ranges::data(r), 2 * std::ranges::size(r));
+}
+
+}  // namespace gsl::type
@@ -0,0 +1,194 @@
+#pragma once
+
+#include <gsl/math/real.h>
+#include <gsl/type/complex.h>
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <iostream>
+#include <span>
+
+namespace gsl::type {
+
+/* A complex number stored as magnitude and angle
+ *
+ * polar_complex<T> is the companion of complex_base<T> for chains of
+ * multiplications, divisions, powers and roots: each of them is a couple
+ * of real operations on (magnitude, angle) instead of a sqrt and an atan2
+ * on (real, imag). The conversions are explicit and done once, at the ends
+ * of the chain: from complex_base<T> they take dist() and angle_in_rads(),
+ * to complex_base<T> one sincos. Addition has no cheap polar form and is
+ * not provided, convert first.
+ *
+ * The angle is kept in [-pi, pi] (to the rounding of pi<T>) after every
+ * operation so it does not drift away from the accurate range of sincos
+ * over a long chain. The magnitude is not negative; the constructor folds
+ * a negative one into the angle. The batch conversions to and from
+ * complex_base<T> spans are gsl::math::to_polar and gsl::math::from_polar
+ * (gsl/math/complex_batch.h), the span forms of the operations are at the
+ * end of this file. */
+
+template <std::floating_point T>
+class polar_complex {
+ public:
+  using el_type = T;
+  using self_type = polar_complex<el_type>;
+  using rect_type = complex_base<el_type>;
+  using packed_type = std::array<el_type, 2>;
+
+ private:
+  static constexpr el_type pi = gsl::math::real::pi<el_type>;
+  static constexpr el_type two_pi = 2 * pi;
+
+  packed_type data;
+
+  struct reduced_t {};
+
+  constexpr polar_complex(reduced_t, el_type mag, el_type rads)
+      : data{mag, rads} {}
+
+  /* a + k 2 pi in [-pi, pi]. turn() takes off the single turn of a sum of
+   * two reduced angles with selects, so the loops over spans vectorize,
+   * wrap() any number of turns, with an exact fmod: the turns of a large
+   * angle overflow any integer */
+  static constexpr el_type turn(el_type a) {
+    a = a > pi ? a - two_pi : a;
+    return a < -pi ? a + two_pi : a;
+  }
+
+  static constexpr el_type wrap(el_type a) {
+    a = turn(a);
+    if ((a >= -pi && a <= pi) || !gsl::math::real::isfinite(a)) return a;
+    return turn(gsl::math::real::fmod(a, two_pi));
+  }
+
+ public:
+  constexpr polar_complex() : data{0, 0} {}
+  constexpr polar_complex(el_type mag, el_type rads)
+      : data{gsl::math::real::fabs(mag),
+             wrap(mag < 0 ? rads + pi : rads)} {}
+
+  constexpr explicit polar_complex(const rect_type& z)
+      : data{z.dist(), z.angle_in_rads()} {}
+
+  constexpr explicit operator rect_type() const { return rect(); }
+
+  constexpr rect_type rect() const {
+    return rect_type{rect_type::polar, dist(), angle_in_rads()};
+  }
+
+  constexpr el_type dist() const { return std::get<0>(data); }
+  constexpr el_type angle_in_rads() const { return std::get<1>(data); }
+
+  constexpr el_type norm() const { return dist() * dist(); }
+
+  constexpr bool operator==(const self_type& rhs) const = default;
+
+  constexpr self_type conjugate() const {
+    return {reduced_t{}, dist(), -angle_in_rads()};
+  }
+
+  constexpr self_type inverse() const {
+    return {reduced_t{}, 1 / dist(), -angle_in_rads()};
+  }
+
+  constexpr self_type neg() const {
+    return {reduced_t{}, dist(), turn(angle_in_rads() + pi)};
+  }
+
+  constexpr self_type operator-() const { return neg(); }
+
+  constexpr self_type operator*(const self_type& rhs) const {
+    return {reduced_t{}, dist() * rhs.dist(),
+            turn(angle_in_rads() + rhs.angle_in_rads())};
+  }
+
+  constexpr self_type operator/(const self_type& rhs) const {
+    return {reduced_t{}, dist() / rhs.dist(),
+            turn(angle_in_rads() - rhs.angle_in_rads())};
+  }
+
+  constexpr self_type& operator*=(const self_type& rhs) {
+    return *this = *this * rhs;
+  }
+  constexpr self_type& operator/=(const self_type& rhs) {
+    return *this = *this / rhs;
+  }
+
+  /* z^n and z^x, the angle is n (x) times the stored one */
+  constexpr self_type pow(int n) const {
+    const auto x = static_cast<el_type>(n);
+    return {reduced_t{}, gsl::math::real::pow(dist(), x),
+            wrap(x * angle_in_rads())};
+  }
+
+  constexpr self_type pow(el_type x) const {
+    return {reduced_t{}, gsl::math::real::pow(dist(), x),
+            wrap(x * angle_in_rads())};
+  }
+
+  /* the principal square and n-th roots, n != 0 */
+  constexpr self_type sqrt() const {
+    return {reduced_t{}, gsl::math::real::sqrt(dist()), angle_in_rads() / 2};
+  }
+
+  constexpr self_type root(int n) const {
+    const auto x = static_cast<el_type>(n);
+    return {reduced_t{}, gsl::math::real::pow(dist(), 1 / x),
+            angle_in_rads() / x};
+  }
+
+  /* the principal logarithm, in rectangular form */
+  constexpr rect_type log() const {
+    return {gsl::math::real::log(dist()), angle_in_rads()};
+  }
+
+  friend auto& operator<<(std::ostream& out, const self_type& v) {
+    out << v.dist() << "*e^(" << v.angle_in_rads() << "i)";
+    return out;
+  }
+
+  constexpr static self_type ONE{reduced_t{}, 1, 0};
+  constexpr static self_type I{reduced_t{}, 1, pi / 2};
+};
+
+using polar_complex_long_double = polar_complex<long double>;
+using polar_complex_double = polar_complex<double>;
+using polar_complex_float = polar_complex<float>;
+
+/* Span forms, over min() of the span sizes elements, out may be one of the
+ * inputs */
+
+template <std::floating_point T>
+constexpr void mul(std::span<const polar_complex<T>> a,
+                   std::span<const polar_complex<T>> b,
+                   std::span<polar_complex<T>> out) {
+  const auto n = std::min({a.size(), b.size(), out.size()});
+  for (std::size_t i = 0; i < n; i++) out[i] = a[i] * b[i];
+}
+
+template <std::floating_point T>
+constexpr void div(std::span<const polar_complex<T>> a,
+                   std::span<const polar_complex<T>> b,
+                   std::span<polar_complex<T>> out) {
+  const auto n = std::min({a.size(), b.size(), out.size()});
+  for (std::size_t i = 0; i < n; i++) out[i] = a[i] / b[i];
+}
+
+template <std::floating_point T>
+constexpr void pow(std::span<const polar_complex<T>> in, int n,
+                   std::span<polar_complex<T>> out) {
+  const auto m = std::min(in.size(), out.size());
+  for (std::size_t i = 0; i < m; i++) out[i] = in[i].pow(n);
+}
+
+template <std::floating_point T>
+constexpr void root(std::span<const polar_complex<T>> in, int n,
+                    std::span<polar_complex<T>> out) {
+  const auto m = std::min(in.size(), out.size());
+  for (std::size_t i = 0; i < m; i++) out[i] = in[i].root(n);
+}
+
+}  // namespace gsl::type
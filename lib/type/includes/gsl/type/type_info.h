@@ -1,13 +1,47 @@
 #pragma once
 
-#include <gsl/gsl_machine.h>
+#include <gsl/constant/machine.h>
+#include <gsl/math/isa.h>
 #include <gsl/type/complex.h>
 
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
 namespace gsl::type {
 
+namespace detail {
+/* the epsilons of the tables, as the doubles they always were */
+constexpr double dbl_epsilon = gsl::constant::machine::machine<double>::EPSILON;
+constexpr double flt_epsilon = gsl::constant::machine::machine<float>::EPSILON;
+}  // namespace detail
+
 template <typename T>
 struct type_info {};
 
+/* a double_double is stored and read as its two doubles, hi then lo */
+template <>
+struct type_info<complex_double_double> {
+  using ELEMENT_TYPE = complex_double_double;
+  using SHORT = complex_double_double;
+  using SHORT_REAL = double_double;
+  using ATOMIC = double;
+  using ATOMIC_IO = ATOMIC;
+
+  static constexpr auto uses_long_double = false;
+  static constexpr auto multiplicity = 4;
+  static constexpr auto is_using_floating_point = true;
+  static constexpr auto input_format = "%lg";
+  static constexpr auto output_format = "%.17lg";
+  static constexpr ELEMENT_TYPE ZERO = ELEMENT_TYPE::ZERO;
+  static constexpr ELEMENT_TYPE ONE = ELEMENT_TYPE::ONE;
+  static constexpr auto BASE_EPSILON =
+      std::numeric_limits<double_double>::epsilon();
+  static constexpr auto is_unsigned = false;
+};
+
 template <>
 struct type_info<complex_long_double> {
   using ELEMENT_TYPE = complex_long_double;
@@ -22,7 +56,7 @@ struct type_info<complex_long_double> {
   static constexpr auto output_format = "%Lg";
   static constexpr ELEMENT_TYPE ZERO = ELEMENT_TYPE::ZERO;
   static constexpr ELEMENT_TYPE ONE = ELEMENT_TYPE::ONE;
-  static constexpr auto BASE_EPSILON = GSL_DBL_EPSILON;
+  static constexpr auto BASE_EPSILON = detail::dbl_epsilon;
   static constexpr auto is_unsigned = false;
 };
 
@@ -41,7 +75,7 @@ struct type_info<complex> {
   static constexpr auto output_format = "%lg";
   static constexpr ELEMENT_TYPE ZERO = ELEMENT_TYPE::ZERO;
   static constexpr ELEMENT_TYPE ONE = ELEMENT_TYPE::ONE;
-  static constexpr auto BASE_EPSILON = GSL_DBL_EPSILON;
+  static constexpr auto BASE_EPSILON = detail::dbl_epsilon;
   static constexpr auto is_unsigned = false;
 };
 
@@ -60,7 +94,103 @@ struct type_info<complex_float> {
   static constexpr auto output_format = "%g";
   static constexpr ELEMENT_TYPE ZERO = ELEMENT_TYPE::ZERO;
   static constexpr ELEMENT_TYPE ONE = ELEMENT_TYPE::ONE;
-  static constexpr auto BASE_EPSILON = GSL_FLT_EPSILON;
+  static constexpr auto BASE_EPSILON = detail::flt_epsilon;
+  static constexpr auto is_unsigned = false;
+};
+
+/* the 16 bit types are read and written through float */
+template <>
+struct type_info<complex_float16> {
+  using ELEMENT_TYPE = complex_float16;
+  using SHORT = complex_float16;
+  using SHORT_REAL = float16;
+  using ATOMIC = SHORT_REAL;
+  using ATOMIC_IO = float;
+
+  static constexpr auto uses_long_double = false;
+  static constexpr auto multiplicity = 2;
+  static constexpr auto is_using_floating_point = true;
+  static constexpr auto input_format = "%g";
+  static constexpr auto output_format = "%g";
+  static constexpr ELEMENT_TYPE ZERO = ELEMENT_TYPE::ZERO;
+  static constexpr ELEMENT_TYPE ONE = ELEMENT_TYPE::ONE;
+  static constexpr auto BASE_EPSILON = std::numeric_limits<float16>::epsilon();
+  static constexpr auto is_unsigned = false;
+};
+
+template <>
+struct type_info<complex_bfloat16> {
+  using ELEMENT_TYPE = complex_bfloat16;
+  using SHORT = complex_bfloat16;
+  using SHORT_REAL = bfloat16;
+  using ATOMIC = SHORT_REAL;
+  using ATOMIC_IO = float;
+
+  static constexpr auto uses_long_double = false;
+  static constexpr auto multiplicity = 2;
+  static constexpr auto is_using_floating_point = true;
+  static constexpr auto input_format = "%g";
+  static constexpr auto output_format = "%g";
+  static constexpr ELEMENT_TYPE ZERO = ELEMENT_TYPE::ZERO;
+  static constexpr ELEMENT_TYPE ONE = ELEMENT_TYPE::ONE;
+  static constexpr auto BASE_EPSILON =
+      std::numeric_limits<bfloat16>::epsilon();
+  static constexpr auto is_unsigned = false;
+};
+
+template <>
+struct type_info<double_double> {
+  using ELEMENT_TYPE = double_double;
+  using SHORT = ELEMENT_TYPE;
+  using ATOMIC = double;
+  using ATOMIC_IO = ATOMIC;
+
+  static constexpr auto uses_long_double = false;
+  static constexpr auto multiplicity = 2;
+  static constexpr auto is_using_floating_point = true;
+  static constexpr auto input_format = "%lg";
+  static constexpr auto output_format = "%.17lg";
+  static constexpr ELEMENT_TYPE ZERO = 0.0;
+  static constexpr ELEMENT_TYPE ONE = 1.0;
+  static constexpr auto BASE_EPSILON =
+      std::numeric_limits<double_double>::epsilon();
+  static constexpr auto is_unsigned = false;
+};
+
+template <>
+struct type_info<float16> {
+  using ELEMENT_TYPE = float16;
+  using SHORT = ELEMENT_TYPE;
+  using ATOMIC = ELEMENT_TYPE;
+  using ATOMIC_IO = float;
+
+  static constexpr auto uses_long_double = false;
+  static constexpr auto multiplicity = 1;
+  static constexpr auto is_using_floating_point = true;
+  static constexpr auto input_format = "%g";
+  static constexpr auto output_format = "%g";
+  static constexpr ELEMENT_TYPE ZERO = 0.0F;
+  static constexpr ELEMENT_TYPE ONE = 1.0F;
+  static constexpr auto BASE_EPSILON = std::numeric_limits<float16>::epsilon();
+  static constexpr auto is_unsigned = false;
+};
+
+template <>
+struct type_info<bfloat16> {
+  using ELEMENT_TYPE = bfloat16;
+  using SHORT = ELEMENT_TYPE;
+  using ATOMIC = ELEMENT_TYPE;
+  using ATOMIC_IO = float;
+
+  static constexpr auto uses_long_double = false;
+  static constexpr auto multiplicity = 1;
+  static constexpr auto is_using_floating_point = true;
+  static constexpr auto input_format = "%g";
+  static constexpr auto output_format = "%g";
+  static constexpr ELEMENT_TYPE ZERO = 0.0F;
+  static constexpr ELEMENT_TYPE ONE = 1.0F;
+  static constexpr auto BASE_EPSILON =
+      std::numeric_limits<bfloat16>::epsilon();
   static constexpr auto is_unsigned = false;
 };
 
@@ -78,7 +208,7 @@ struct type_info<long double> {
   static constexpr auto output_format = "%Lg";
   static constexpr ELEMENT_TYPE ZERO = 0.0L;
   static constexpr ELEMENT_TYPE ONE = 1.0L;
-  static constexpr auto BASE_EPSILON = GSL_DBL_EPSILON;
+  static constexpr auto BASE_EPSILON = detail::dbl_epsilon;
   static constexpr auto is_unsigned = false;
 };
 
@@ -96,7 +226,7 @@ struct type_info<double> {
   static constexpr auto output_format = "%lg";
   static constexpr ELEMENT_TYPE ZERO = 0.0;
   static constexpr ELEMENT_TYPE ONE = 1.0;
-  static constexpr auto BASE_EPSILON = GSL_DBL_EPSILON;
+  static constexpr auto BASE_EPSILON = detail::dbl_epsilon;
   static constexpr auto is_unsigned = false;
 };
 
@@ -114,7 +244,7 @@ struct type_info<float> {
   static constexpr auto output_format = "%g";
   static constexpr ELEMENT_TYPE ZERO = 0.0F;
   static constexpr ELEMENT_TYPE ONE = 1.0F;
-  static constexpr auto BASE_EPSILON = GSL_FLT_EPSILON;
+  static constexpr auto BASE_EPSILON = detail::flt_epsilon;
   static constexpr auto is_unsigned = false;
 };
 
@@ -254,4 +384,114 @@ struct type_info<char> {
   static constexpr auto is_unsigned = false;
 };
 
+/* How a T maps onto the vector registers
+ *
+ * simd_info<T, V> is derived from the layout of T for the variant V of
+ * gsl/math/isa.h, by default the one the code is compiled for. It is
+ * defined for every T, there is nothing to specialize:
+ *
+ *   lane_type     the scalar a vector lane holds: type_info<T>::ATOMIC when
+ *                 there is one, else that of T::el_type, else T; 16, 32
+ *                 and 64 bit class types (float16, q15, ...) as the
+ *                 unsigned integer of their bits
+ *   vectorizable  there are vector instructions on lane_type (not on long
+ *                 double, not without vector units)
+ *   lanes         lane_type values in a register, 1 when not vectorizable
+ *   elements      T values in a register, 0 when a T is wider than one
+ *   alignment     of the buffers of T the kernels read with aligned loads:
+ *                 the register width when vectorizable, alignof(T) else
+ *   vector_type   a register of lane_type (the GNU vector extension),
+ *                 lane_type when not vectorizable
+ *   single_load   a T is read into a register by one instruction
+ *
+ * simd_info<T, dispatch::widest>::alignment suits every variant select()
+ * can bind, complex_array and the blocks of the batch kernels use it. */
+
+namespace detail::simd {
+
+using gsl::math::dispatch::isa;
+
+template <typename T>
+struct scalar {
+  using type = T;
+};
+
+template <typename T>
+  requires requires { typename type_info<T>::ATOMIC; }
+struct scalar<T> {
+  using type = typename type_info<T>::ATOMIC;
+};
+
+template <typename T>
+  requires(!requires { typename type_info<T>::ATOMIC; } &&
+           requires { typename T::el_type; })
+struct scalar<T> {
+  using type = typename scalar<typename T::el_type>::type;
+};
+
+template <typename S>
+struct bits {
+  using type = S;
+};
+
+template <typename S>
+  requires(std::is_class_v<S> && std::is_trivially_copyable_v<S>)
+struct bits<S> {
+  using type = std::conditional_t<
+      sizeof(S) == 2, std::uint16_t,
+      std::conditional_t<sizeof(S) == 4, std::uint32_t,
+                         std::conditional_t<sizeof(S) == 8, std::uint64_t,
+                                            S>>>;
+};
+
+template <typename T>
+using lane_t = typename bits<typename scalar<T>::type>::type;
+
+template <typename L, std::size_t N>
+struct vector {
+  using type = L;
+};
+
+#if defined(__GNUC__)
+template <typename L, std::size_t N>
+  requires(N > 0)
+struct vector<L, N> {
+  typedef L type __attribute__((vector_size(N)));
+};
+#endif
+
+}  // namespace detail::simd
+
+template <typename T,
+          gsl::math::dispatch::isa V = gsl::math::dispatch::isa::generic>
+struct simd_info {
+  using lane_type = detail::simd::lane_t<T>;
+
+  static constexpr std::size_t register_bytes =
+      gsl::math::dispatch::register_bytes(V);
+
+  static constexpr bool vectorizable =
+      std::is_arithmetic_v<lane_type> && !std::is_same_v<lane_type, bool> &&
+      !std::is_same_v<lane_type, long double> &&
+      register_bytes >= 2 * sizeof(lane_type);
+
+  static constexpr std::size_t lanes =
+      vectorizable ? register_bytes / sizeof(lane_type) : 1;
+
+  static constexpr std::size_t elements =
+      vectorizable ? register_bytes / sizeof(T)
+                   : std::size_t{sizeof(T) == sizeof(lane_type)};
+
+  static constexpr std::size_t alignment =
+      vectorizable && register_bytes > alignof(T) ? register_bytes : alignof(T);
+
+  using vector_type =
+      typename detail::simd::vector<lane_type,
+                                    vectorizable ? register_bytes : 0>::type;
+
+  static constexpr bool single_load =
+      std::is_trivially_copyable_v<T> && std::has_single_bit(sizeof(T)) &&
+      sizeof(T) <= (vectorizable ? register_bytes : sizeof(lane_type));
+};
+
 }  // namespace gsl::type
@@ -0,0 +1,159 @@
+#include <gsl/type/complex.h>
+#include <gsl/type/complex_array.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+using gsl::type::complex;
+using gsl::type::complex_array;
+using gsl::type::complex_array_double;
+using gsl::type::complex_array_float;
+
+#define EXPECT_EQ_DBL(a, b) EXPECT_TRUE(abs((a) - (b)) < 1e-15L)
+
+#define EXPECT_STATUS_RECT(v, real_exp, img_exp) \
+  {                                              \
+    EXPECT_EQ_DBL((v).real(), (real_exp));       \
+    EXPECT_EQ_DBL((v).img(), (img_exp));         \
+  }
+
+TEST(GSLTypeComplexArray, ConstructorsTest) {
+  {
+    const complex_array_double a;
+    EXPECT_TRUE(a.empty());
+    EXPECT_EQ(a.size(), 0U);
+  }
+
+  {
+    const complex_array_double a(5);
+    EXPECT_EQ(a.size(), 5U);
+    for (size_t i = 0; i < a.size(); i++) {
+      EXPECT_STATUS_RECT(a[i], 0, 0);
+    }
+  }
+
+  {
+    const complex_array_double a(3, complex{1, -2});
+    for (size_t i = 0; i < a.size(); i++) {
+      EXPECT_STATUS_RECT(a[i], 1, -2);
+    }
+  }
+
+  {
+    const complex_array_double a{{1, 2}, {3, 4}, {5, 6}};
+    EXPECT_EQ(a.size(), 3U);
+    EXPECT_STATUS_RECT(a[0], 1, 2);
+    EXPECT_STATUS_RECT(a[1], 3, 4);
+    EXPECT_STATUS_RECT(a[2], 5, 6);
+  }
+
+  /* a length whose byte count wraps around */
+  EXPECT_THROW(complex_array_double(SIZE_MAX / 4), std::length_error);
+  EXPECT_THROW(complex_array_float(SIZE_MAX), std::length_error);
+}
+
+TEST(GSLTypeComplexArray, AlignmentTest) {
+  for (size_t n : {1, 3, 17, 1000}) {
+    complex_array_float a(n);
+    const auto re = reinterpret_cast<std::uintptr_t>(a.real_data());
+    const auto im = reinterpret_cast<std::uintptr_t>(a.img_data());
+    EXPECT_EQ(re % complex_array_float::alignment, 0U);
+    EXPECT_EQ(im % complex_array_float::alignment, 0U);
+  }
+}
+
+TEST(GSLTypeComplexArray, CopyMoveTest) {
+  {
+    const complex_array_double a{{1, 2}, {3, 4}};
+    const auto b = a;
+    EXPECT_EQ(a, b);
+    EXPECT_NE(a.real_data(), b.real_data());
+  }
+
+  {
+    complex_array_double a{{1, 2}, {3, 4}};
+    const auto* re = a.real_data();
+    const auto b = std::move(a);
+    EXPECT_EQ(b.real_data(), re);
+    EXPECT_TRUE(a.empty());
+    EXPECT_STATUS_RECT(b[1], 3, 4);
+  }
+
+  {
+    complex_array_double a{{1, 2}};
+    const complex_array_double b{{5, 6}, {7, 8}};
+    a = b;
+    EXPECT_EQ(a, b);
+  }
+}
+
+TEST(GSLTypeComplexArray, ReferenceProxyTest) {
+  complex_array_double a(2);
+
+  a[0] = complex{3, 4};
+  EXPECT_STATUS_RECT(a[0], 3, 4);
+  EXPECT_EQ_DBL(a[0].norm(), 25);
+  EXPECT_EQ_DBL(a[0].dist(), 5);
+  EXPECT_EQ_DBL(a[0].angle_in_rads(), atan2(4.0, 3.0));
+  EXPECT_STATUS_RECT(a[0].congugate(), 3, -4);
+  EXPECT_STATUS_RECT(-a[0], -3, -4);
+
+  a[1].real() = -1;
+  a[1].img() = 2;
+  EXPECT_EQ_DBL(a.reals()[1], -1);
+  EXPECT_EQ_DBL(a.imags()[1], 2);
+
+  EXPECT_STATUS_RECT(a[0] + a[1], 2, 6);
+  EXPECT_STATUS_RECT(a[0] - a[1], 4, 2);
+  EXPECT_STATUS_RECT(a[0] * a[1], -11, 2);
+  EXPECT_STATUS_RECT(a[0] * 2.0, 6, 8);
+  EXPECT_STATUS_RECT(2.0 * a[0], 6, 8);
+  EXPECT_STATUS_RECT(1.0 + a[0], 4, 4);
+  EXPECT_STATUS_RECT(a[0] / complex(0, 1), 4, -3);
+
+  const complex c = a[0];
+  EXPECT_STATUS_RECT(c, 3, 4);
+  EXPECT_TRUE(a[0] == c);
+
+  a[1] = a[0];
+  EXPECT_STATUS_RECT(a[1], 3, 4);
+}
+
+TEST(GSLTypeComplexArray, IteratorTest) {
+  complex_array_double a(4);
+  int k = 0;
+  for (auto v : a) {
+    v = complex(k, -k);
+    k++;
+  }
+  EXPECT_EQ(a.end() - a.begin(), 4);
+
+  const auto& ca = a;
+  const auto sum = std::accumulate(ca.begin(), ca.end(), complex{});
+  EXPECT_STATUS_RECT(sum, 6, -6);
+}
+
+TEST(GSLTypeComplexArray, InterleaveTest) {
+  std::vector<complex> in(37);
+  for (size_t i = 0; i < in.size(); i++) {
+    in[i] = complex(i * 0.5, -1.0 * i);
+  }
+
+  complex_array_double a{std::span<const complex>{in}};
+  EXPECT_EQ(a.size(), in.size());
+  for (size_t i = 0; i < in.size(); i++) {
+    EXPECT_EQ_DBL(a.reals()[i], in[i].real());
+    EXPECT_EQ_DBL(a.imags()[i], in[i].img());
+  }
+
+  std::vector<complex> out(in.size());
+  a.copy_to(out);
+  EXPECT_EQ(in, out);
+
+  a.assign(std::span<const complex>{in}.first(3));
+  EXPECT_EQ(a.size(), 3U);
+  EXPECT_STATUS_RECT(a[2], 1, -2);
+}
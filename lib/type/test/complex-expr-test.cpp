@@ -0,0 +1,123 @@
+#include <gsl/type/complex.h>
+#include <gsl/type/complex_array.h>
+#include <gsl/type/complex_expr.h>
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <vector>
+
+using gsl::type::complex;
+using gsl::type::complex_array_double;
+using gsl::type::complex_array_float;
+using gsl::type::complex_float;
+
+namespace expr = gsl::type::expr;
+
+namespace {
+
+complex_array_double ramp(size_t n) {
+  complex_array_double r(n);
+  for (size_t i = 0; i < n; i++) {
+    r[i] = complex{0.5 * i - 3, 1.0 - 0.25 * i};
+  }
+  return r;
+}
+
+}  // namespace
+
+TEST(GSLTypeComplexExpr, ArrayTest) {
+  using namespace gsl::type::expr;
+
+  const auto x = ramp(37);
+  const complex a{2, -1}, b{0.5, 3};
+
+  complex_array_double y = a * x + b * conj(x);
+  ASSERT_EQ(y.size(), x.size());
+  for (size_t i = 0; i < x.size(); i++) {
+    EXPECT_EQ(y[i], a * x[i] + b * x[i].congugate());
+  }
+
+  /* the target may appear in the expression */
+  y = y - x * 2.0 + 1.0;
+  for (size_t i = 0; i < x.size(); i++) {
+    EXPECT_EQ(y[i],
+              a * x[i] + b * x[i].congugate() - x[i] * 2.0 + 1.0);
+  }
+
+  /* a different size reallocates */
+  const auto z = ramp(5);
+  y = -z;
+  ASSERT_EQ(y.size(), 5U);
+  for (size_t i = 0; i < z.size(); i++) {
+    EXPECT_EQ(y[i], -z[i]);
+  }
+}
+
+TEST(GSLTypeComplexExpr, SizeTest) {
+  using namespace gsl::type::expr;
+
+  /* operands of different sizes do not truncate */
+  const auto x = ramp(8);
+  const auto z = ramp(5);
+  complex_array_double y = x;
+  EXPECT_THROW(y = x * z, std::invalid_argument);
+  EXPECT_THROW(y = x + 1.0 - conj(z), std::invalid_argument);
+  EXPECT_EQ(y.size(), 8U);
+
+  /* a tree without array or span operand has no size */
+  const complex a{2, -1};
+  static_assert(decltype(x * a)::sized);
+  static_assert(decltype(a * conj(x) + 2.0)::sized);
+  static_assert(!decltype(lazy(a) * 2.0)::sized);
+  static_assert(!decltype(-lazy(a) + a)::sized);
+}
+
+TEST(GSLTypeComplexExpr, DivisionTest) {
+  using namespace gsl::type::expr;
+
+  const auto x = ramp(16);
+  const auto y = ramp(16);
+  const complex_array_double q = x / (y + complex{0, 7});
+  const complex_array_double r = 2.0 / (y + complex{0, 7});
+  const complex_array_double s = x / 4.0;
+  for (size_t i = 0; i < x.size(); i++) {
+    const complex d = y[i] + complex{0, 7};
+    EXPECT_NEAR(q[i].real(), (x[i] / d).real(), 1e-15);
+    EXPECT_NEAR(q[i].img(), (x[i] / d).img(), 1e-15);
+    EXPECT_NEAR(r[i].real(), (2.0 / d).real(), 1e-15);
+    EXPECT_NEAR(r[i].img(), (2.0 / d).img(), 1e-15);
+    EXPECT_EQ(s[i], x[i] / 4.0);
+  }
+}
+
+TEST(GSLTypeComplexExpr, SpanTest) {
+  const std::vector<complex> in{{1, 2}, {-3, 0.5}, {0, -1}, {4, 4}};
+  std::vector<complex> out(3, complex{9, 9});
+  const complex w{0, 1};
+
+  /* min(out.size(), in.size()) elements */
+  expr::assign(std::span{out}, expr::lazy(std::span{in}) * w - 1.0);
+  for (size_t i = 0; i < out.size(); i++) {
+    EXPECT_EQ(out[i], in[i] * w - 1.0);
+  }
+}
+
+TEST(GSLTypeComplexExpr, ScalarTest) {
+  constexpr complex u{1, 2}, v{3, -4}, w{0.5, 0.5};
+  constexpr auto z = expr::evaluate(expr::lazy(u) * v + w * 2.0);
+  static_assert(z == u * v + w * 2.0);
+
+  const auto q = expr::evaluate(expr::lazy(u) / v);
+  EXPECT_NEAR(q.real(), (u / v).real(), 1e-15);
+  EXPECT_NEAR(q.img(), (u / v).img(), 1e-15);
+}
+
+TEST(GSLTypeComplexExpr, FloatTest) {
+  using namespace gsl::type::expr;
+
+  complex_array_float x(8, complex_float{1.5f, -2});
+  const complex_array_float y = 3 * x - conj(x) / 2;
+  for (size_t i = 0; i < x.size(); i++) {
+    EXPECT_EQ(y[i], 3.0f * x[i] - x[i].congugate() / 2.0f);
+  }
+}
@@ -0,0 +1,162 @@
+#include <gsl/math/fixed.h>
+#include <gsl/type/complex.h>
+#include <gsl/type/complex_int.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+using gsl::type::complex_float;
+using gsl::type::complex_int16;
+using gsl::type::complex_int32;
+using gsl::type::complex_int8;
+using gsl::type::complex_q15;
+using gsl::type::complex_q31;
+using gsl::type::q15;
+using gsl::type::q31;
+
+constexpr std::int16_t min16 = std::numeric_limits<std::int16_t>::min();
+constexpr std::int16_t max16 = std::numeric_limits<std::int16_t>::max();
+
+TEST(GSLTypeComplexInt, FixedTest) {
+  static_assert(q15{0.5F}.bits() == 0x4000);
+  static_assert(q15{-1.0F}.bits() == min16);
+  static_assert(q15{1.0F}.bits() == max16);
+  static_assert(q15{std::nanf("")}.bits() == 0);
+  static_assert(static_cast<float>(q15::from_bits(0x2000)) == 0.25F);
+
+  /* ties to even on the float side */
+  EXPECT_EQ(q15{0x1.8p-15F}.bits(), 2);
+  EXPECT_EQ(q15{0x1.4p-14F}.bits(), 2);
+
+  /* saturation */
+  const auto one = q15::from_bits(max16), neg_one = q15::from_bits(min16);
+  EXPECT_EQ((one + one).bits(), max16);
+  EXPECT_EQ((neg_one - one).bits(), min16);
+  EXPECT_EQ((-neg_one).bits(), max16);
+  EXPECT_EQ((neg_one * neg_one).bits(), max16);
+  EXPECT_EQ((q15{0.5F} * q15{-0.5F}).bits(), q15{-0.25F}.bits());
+  /* the product rounds to nearest, ties up */
+  EXPECT_EQ((q15::from_bits(3) * q15{0.5F}).bits(), 2);
+  EXPECT_EQ((q15::from_bits(-3) * q15{0.5F}).bits(), -1);
+
+  /* q31: the float clamp stays below 2^31 */
+  EXPECT_EQ(q31{1.0F}.bits(), 0x7fffff80);
+  EXPECT_EQ(q31{-2.0F}.bits(), std::numeric_limits<std::int32_t>::min());
+  const auto big = q31::from_bits(std::numeric_limits<std::int32_t>::max());
+  EXPECT_EQ((big + big).bits(), big.bits());
+  EXPECT_EQ((-big - big).bits(), std::numeric_limits<std::int32_t>::min());
+}
+
+TEST(GSLTypeComplexInt, ArithmeticTest) {
+  constexpr complex_int16 a{1000, -2000}, b{-3, 7};
+  static_assert(a + b == complex_int16{997, -1993});
+  static_assert(a * b == complex_int16{11000, 13000});
+  static_assert(a.conjugate() == complex_int16{1000, 2000});
+
+  /* saturating add, subtract and negation */
+  const complex_int16 m{min16, max16};
+  EXPECT_EQ(m + m, (complex_int16{min16, max16}));
+  EXPECT_EQ(m - complex_int16(1, -1), (complex_int16{min16, max16}));
+  EXPECT_EQ(-m, (complex_int16{max16, -max16}));
+  EXPECT_EQ(m.conjugate(), (complex_int16{min16, -max16}));
+
+  /* int8 */
+  const complex_int8 c{100, -100};
+  EXPECT_EQ(c + c, (complex_int8{127, -128}));
+  EXPECT_EQ(mul_wide(c, c), (complex_int16{0, -20000}));
+}
+
+TEST(GSLTypeComplexInt, MulWideTest) {
+  /* exact for every pair but (min, min)^2 */
+  const std::int16_t v[] = {min16, -12345, -1, 0, 1, 321, max16};
+  for (auto ar : v) {
+    for (auto ai : v) {
+      for (auto br : v) {
+        for (auto bi : v) {
+          const complex_int16 a{ar, ai}, b{br, bi};
+          const auto w = mul_wide(a, b);
+          const auto re = std::int64_t{ar} * br - std::int64_t{ai} * bi;
+          const auto im = std::int64_t{ar} * bi + std::int64_t{ai} * br;
+          if (im > std::numeric_limits<std::int32_t>::max()) {
+            EXPECT_EQ(w.img(), std::numeric_limits<std::int32_t>::max());
+          } else {
+            EXPECT_EQ(w.img(), im);
+          }
+          EXPECT_EQ(w.real(), re);
+          /* and the same type product is the clamped one */
+          EXPECT_EQ((a * b).real(),
+                    std::clamp<std::int64_t>(re, min16, max16));
+        }
+      }
+    }
+  }
+
+  /* q15 -> fixed<int32_t, 30>: the exact product */
+  const complex_q15 p{q15{0.5F}, q15{-0.25F}}, q{q15{0.75F}, q15{0.125F}};
+  const auto w = mul_wide(p, q);
+  static_assert(decltype(w)::fraction_bits == 30);
+  const auto f = static_cast<complex_float>(w);
+  EXPECT_EQ(f, (complex_float{0.5F * 0.75F + 0.25F * 0.125F,
+                              0.5F * 0.125F - 0.25F * 0.75F}));
+  EXPECT_EQ(static_cast<complex_float>(p * q), f);
+}
+
+TEST(GSLTypeComplexInt, ConvertTest) {
+  std::vector<complex_int16> iq;
+  for (int i = 0; i < 1001; i++) {
+    iq.emplace_back(static_cast<std::int16_t>(i * 65 - 32768),
+                    static_cast<std::int16_t>(32767 - i * 33));
+  }
+
+  /* int16 -> float -> int16 is exact */
+  std::vector<complex_float> f(iq.size());
+  gsl::type::convert<std::int16_t>(iq, f, 1.0F / 32768);
+  EXPECT_EQ(f[0], (complex_float{-1, 32767.0F / 32768}));
+  std::vector<complex_int16> back(iq.size());
+  gsl::type::convert<std::int16_t>(f, back, 1.0F / 32768);
+  EXPECT_EQ(back, iq);
+
+  /* q15 reads the same bits as the same values */
+  std::vector<complex_q15> q(iq.size());
+  gsl::type::convert<q15>(f, q);
+  for (std::size_t i = 0; i < iq.size(); i++) {
+    EXPECT_EQ(q[i].real_bits(), iq[i].real()) << i;
+    EXPECT_EQ(q[i].img_bits(), iq[i].img()) << i;
+    EXPECT_EQ(static_cast<complex_float>(q[i]), f[i]) << i;
+  }
+
+  /* out of range, nan and ties */
+  const std::vector<complex_float> odd = {
+      {1e9F, -1e9F}, {std::nanf(""), 2.5F}, {-2.5F, 3.5F}};
+  std::vector<complex_int16> o(odd.size());
+  gsl::type::convert<std::int16_t>(odd, o);
+  EXPECT_EQ(o[0], (complex_int16{max16, min16}));
+  EXPECT_EQ(o[1], (complex_int16{0, 2}));
+  EXPECT_EQ(o[2], (complex_int16{-2, 4}));
+  std::vector<complex_int32> o32(odd.size());
+  gsl::type::convert<std::int32_t>(odd, o32);
+  EXPECT_EQ(o32[0], (complex_int32{1000000000, -1000000000}));
+}
+
+TEST(GSLTypeComplexInt, SpanTest) {
+  const std::vector<complex_int16> a = {{30000, -30000}, {1, 2}, {min16, 0}};
+  const std::vector<complex_int16> b = {{30000, -30000}, {3, 4}, {1, 0}};
+  std::vector<complex_int16> out(a.size());
+
+  gsl::type::add<std::int16_t>(a, b, out);
+  EXPECT_EQ(out, (std::vector<complex_int16>{
+                     {max16, min16}, {4, 6}, {-32767, 0}}));
+  gsl::type::sub<std::int16_t>(b, a, out);
+  EXPECT_EQ(out, (std::vector<complex_int16>{{0, 0}, {2, 2}, {max16, 0}}));
+  gsl::type::mul<std::int16_t>(a, b, out);
+  for (std::size_t i = 0; i < a.size(); i++) EXPECT_EQ(out[i], a[i] * b[i]);
+
+  std::vector<complex_int32> wide(a.size());
+  gsl::type::mul_wide<std::int16_t>(a, b, wide);
+  EXPECT_EQ(wide[0], (complex_int32{0, -1800000000}));
+  EXPECT_EQ(wide[1], (complex_int32{-5, 10}));
+}
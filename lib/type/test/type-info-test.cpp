@@ -0,0 +1,78 @@
+#include <gsl/math/isa.h>
+#include <gsl/type/complex.h>
+#include <gsl/type/complex_array.h>
+#include <gsl/type/complex_int.h>
+#include <gsl/type/polar_complex.h>
+#include <gsl/type/type_info.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <type_traits>
+
+using gsl::math::dispatch::isa;
+using gsl::type::complex;
+using gsl::type::complex_double_double;
+using gsl::type::complex_float;
+using gsl::type::complex_float16;
+using gsl::type::complex_long_double;
+using gsl::type::simd_info;
+using gsl::type::type_info;
+
+TEST(GSLTypeTypeInfo, TablesTest) {
+  EXPECT_EQ(type_info<double>::BASE_EPSILON, 0x1p-52);
+  EXPECT_EQ(type_info<complex_float>::BASE_EPSILON, 0x1p-23);
+  static_assert(std::is_same_v<decltype(type_info<float>::BASE_EPSILON),
+                               const double>);
+  EXPECT_EQ(type_info<complex>::multiplicity, 2);
+}
+
+TEST(GSLTypeTypeInfo, SimdTest) {
+  /* lanes and elements per register */
+  using d = simd_info<complex, isa::avx2>;
+  static_assert(std::is_same_v<d::lane_type, double>);
+  static_assert(d::vectorizable && d::lanes == 4 && d::elements == 2);
+  static_assert(d::alignment == 32 && d::single_load);
+  static_assert(sizeof(d::vector_type) == 32);
+
+  using f = simd_info<float, isa::avx512>;
+  static_assert(f::lanes == 16 && f::elements == 16 && f::alignment == 64);
+  static_assert(simd_info<complex_float, isa::sse2>::elements == 2);
+
+  /* types without a type_info, through el_type and their bits */
+  using q = simd_info<gsl::type::complex_q15, isa::avx2>;
+  static_assert(std::is_same_v<q::lane_type, std::uint16_t>);
+  static_assert(q::lanes == 16 && q::elements == 8);
+  using h = simd_info<complex_float16, isa::sse2>;
+  static_assert(std::is_same_v<h::lane_type, std::uint16_t>);
+  static_assert(simd_info<gsl::type::polar_complex_float, isa::avx2>::lanes ==
+                8);
+
+  /* wider than a register and not vectorizable at all */
+  using w = simd_info<complex_double_double, isa::sse2>;
+  static_assert(w::vectorizable && w::elements == 0 && !w::single_load);
+  using l = simd_info<complex_long_double, isa::avx512>;
+  static_assert(!l::vectorizable && l::lanes == 1 && l::elements == 0);
+  static_assert(l::alignment == alignof(complex_long_double));
+  static_assert(std::is_same_v<l::vector_type, long double>);
+  static_assert(simd_info<long double>::single_load &&
+                simd_info<long double>::elements == 1);
+
+  /* the compiled variant is at least the baseline on x86-64 */
+  EXPECT_GE(simd_info<double>::lanes, 1U);
+#if defined(__x86_64__)
+  EXPECT_GE(simd_info<double>::lanes, 2U);
+#endif
+}
+
+TEST(GSLTypeTypeInfo, ContainerTest) {
+  /* complex_array is aligned for the widest variant */
+  constexpr auto widest = gsl::math::dispatch::widest;
+  static_assert(gsl::type::complex_array_double::alignment ==
+                simd_info<double, widest>::alignment);
+  static_assert(gsl::type::complex_array_long_double::alignment ==
+                alignof(long double));
+  gsl::type::complex_array_long_double a(5);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(a.real_data()) %
+                alignof(long double),
+            0U);
+}
@@ -0,0 +1,195 @@
+#!/usr/bin/env python3
+"""Compare google benchmark JSON results against a baseline.
+
+Both files must come from runs with --benchmark_repetitions=N (N >= 2), the
+repetitions of a benchmark are its samples. For every benchmark present in
+both files the relative change of the mean time is estimated with a Welch
+t confidence interval:
+
+  regression   the whole interval is above +threshold
+  improvement  the whole interval is below -threshold
+  unchanged    otherwise
+
+Benchmarks named <mode>/<function>/<type>/<regime> (gsl-lib-math-complex.bench)
+are also summarised per function and type. The exit status is 1 when a
+regression is found. Only the standard library is needed.
+"""
+
+import argparse
+import json
+import math
+import statistics
+import sys
+
+TIME_UNITS = {"ns": 1e-9, "us": 1e-6, "ms": 1e-3, "s": 1.0}
+
+
+def samples(path, metric):
+    """benchmark name -> list of per iteration times in seconds"""
+    with open(path) as f:
+        data = json.load(f)
+
+    out = {}
+    for b in data.get("benchmarks", []):
+        if b.get("run_type", "iteration") != "iteration":
+            continue
+        if b.get("error_occurred"):
+            continue
+        name = b.get("run_name", b["name"])
+        scale = TIME_UNITS[b.get("time_unit", "ns")]
+        out.setdefault(name, []).append(b[metric] * scale)
+    return out
+
+
+def betacf(a, b, x):
+    """continued fraction of the incomplete beta function (Lentz)"""
+    tiny = 1e-300
+    c, d = 1.0, 1.0 - (a + b) * x / (a + 1)
+    d = 1.0 / (d if abs(d) > tiny else tiny)
+    h = d
+    for m in range(1, 300):
+        m2 = 2 * m
+        for num in (m * (b - m) * x / ((a + m2 - 1) * (a + m2)),
+                    -(a + m) * (a + b + m) * x / ((a + m2) * (a + m2 + 1))):
+            d = 1.0 + num * d
+            d = 1.0 / (d if abs(d) > tiny else tiny)
+            c = 1.0 + num / c
+            c = c if abs(c) > tiny else tiny
+            h *= d * c
+        if abs(d * c - 1.0) < 1e-15:
+            break
+    return h
+
+
+def betainc(a, b, x):
+    """regularized incomplete beta function I_x(a, b)"""
+    if x <= 0:
+        return 0.0
+    if x >= 1:
+        return 1.0
+    lbeta = math.lgamma(a + b) - math.lgamma(a) - math.lgamma(b)
+    front = math.exp(lbeta + a * math.log(x) + b * math.log1p(-x))
+    if x < (a + 1) / (a + b + 2):
+        return front * betacf(a, b, x) / a
+    return 1.0 - front * betacf(b, a, 1 - x) / b
+
+
+def t_cdf(t, df):
+    p = 0.5 * betainc(df / 2, 0.5, df / (df + t * t))
+    return 1 - p if t > 0 else p
+
+
+def t_quantile(p, df):
+    """inverse of t_cdf by bisection, p > 0.5"""
+    lo, hi = 0.0, 1e3
+    for _ in range(200):
+        mid = (lo + hi) / 2
+        if t_cdf(mid, df) < p:
+            lo = mid
+        else:
+            hi = mid
+    return (lo + hi) / 2
+
+
+def compare(base, cur, confidence):
+    """interval of (mean(cur) - mean(base)) / mean(base)"""
+    ma, mb = statistics.fmean(base), statistics.fmean(cur)
+    va, vb = statistics.variance(base), statistics.variance(cur)
+    na, nb = len(base), len(cur)
+    se2 = va / na + vb / nb
+    if se2 == 0:
+        lo = hi = mb - ma
+    else:
+        df = se2 * se2 / ((va / na) ** 2 / (na - 1) + (vb / nb) ** 2 / (nb - 1))
+        h = t_quantile(0.5 + confidence / 2, df) * math.sqrt(se2)
+        lo, hi = mb - ma - h, mb - ma + h
+    return (mb - ma) / ma, lo / ma, hi / ma
+
+
+def main():
+    p = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    p.add_argument("baseline")
+    p.add_argument("current")
+    p.add_argument("--confidence", type=float, default=0.99)
+    p.add_argument("--threshold", type=float, default=0.05,
+                   help="smallest relative slowdown reported")
+    p.add_argument("--metric", choices=["real_time", "cpu_time"],
+                   default="cpu_time")
+    p.add_argument("--json", help="write the comparison to this file")
+    args = p.parse_args()
+
+    try:
+        base = samples(args.baseline, args.metric)
+    except FileNotFoundError:
+        print(f"no baseline at {args.baseline}, record one first",
+              file=sys.stderr)
+        return 2
+    cur = samples(args.current, args.metric)
+
+    rows = []
+    for name in sorted(set(base) & set(cur)):
+        a, b = base[name], cur[name]
+        if len(a) < 2 or len(b) < 2:
+            print(f"{name}: needs --benchmark_repetitions >= 2, skipped",
+                  file=sys.stderr)
+            continue
+        change, lo, hi = compare(a, b, args.confidence)
+        verdict = "unchanged"
+        if lo > args.threshold:
+            verdict = "regression"
+        elif hi < -args.threshold:
+            verdict = "improvement"
+        rows.append({"name": name, "change": change, "low": lo, "high": hi,
+                     "verdict": verdict})
+
+    for name in sorted(set(base) ^ set(cur)):
+        where = "baseline" if name in base else "current run"
+        print(f"{name}: only in the {where}", file=sys.stderr)
+
+    width = max((len(r["name"]) for r in rows), default=4)
+    for r in rows:
+        if r["verdict"] == "unchanged":
+            continue
+        print(f"{r['name']:<{width}}  {r['change']:+8.1%}  "
+              f"[{r['low']:+.1%}, {r['high']:+.1%}]  {r['verdict']}")
+
+    # per function and type
+    groups = {}
+    for r in rows:
+        parts = r["name"].split("/")
+        if len(parts) != 4:
+            continue
+        g = groups.setdefault((parts[1], parts[2]),
+                              {"regression": 0, "improvement": 0,
+                               "unchanged": 0, "worst": -math.inf})
+        g[r["verdict"]] += 1
+        g["worst"] = max(g["worst"], r["change"])
+
+    regressed = [k for k, g in groups.items() if g["regression"]]
+    if groups:
+        print(f"\n{len(groups)} function/type pairs, "
+              f"{len(regressed)} with regressions")
+        for fn, ty in sorted(regressed):
+            g = groups[(fn, ty)]
+            print(f"  {fn} ({ty}): {g['regression']} regressed, "
+                  f"worst {g['worst']:+.1%}")
+
+    n = sum(r["verdict"] == "regression" for r in rows)
+    print(f"\n{len(rows)} benchmarks compared at {args.confidence:.0%} "
+          f"confidence, {n} regressions above {args.threshold:.0%}")
+
+    if args.json:
+        with open(args.json, "w") as f:
+            json.dump({"confidence": args.confidence,
+                       "threshold": args.threshold,
+                       "metric": args.metric,
+                       "benchmarks": rows,
+                       "functions": [{"function": fn, "type": ty, **g}
+                                     for (fn, ty), g in sorted(groups.items())]},
+                      f, indent=2)
+
+    return 1 if n else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())